@@ -29,6 +29,8 @@ using OptionsEntries = std::vector<OptionsEntry>;
 static inline const OptionsDict DefaultAppOptions = {
   { "input", "" },
   { "output", "" },
+  { "output-all-groups", "false" },
+  { "server", "" },
   { "list-bindings", "false" },
   { "no-background", "false" },
   { "config", "" },
@@ -67,6 +69,7 @@ static inline const OptionsDict DefaultAppOptions = {
   { "interaction-test-play", "" },
   { "command-script", "" },
   { "frame-rate", "30.0" },
+  { "output-views", "8" },
 };
 
 /**
@@ -128,6 +131,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "light-intensity", "render.light.intensity" },
   { "line-width", "render.line_width" },
   { "loading-progress", "ui.loader_progress" },
+  { "lod", "render.lod.enable" },
   { "metadata", "ui.metadata" },
   { "metallic", "model.material.metallic" },
   { "normal-glyphs", "model.normal_glyphs.enable" },
@@ -137,6 +141,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "opacity", "model.color.opacity" },
   { "point-size", "render.point_size" },
   { "point-sprites", "model.point_sprites.type" },
+  { "progressive", "render.progressive.enable" },
   { "point-sprites-absolute-size", "model.point_sprites.absolute_size" },
   { "point-sprites-size", "model.point_sprites.size" },
   { "raytracing", "render.raytracing.enable" },
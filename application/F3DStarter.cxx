@@ -43,13 +43,17 @@
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <cctype>
+#include <chrono>
 #include <cmath>
 #include <csignal>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
@@ -59,14 +63,24 @@
 #include <regex>
 #include <set>
 #include <sstream>
+#include <streambuf>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #ifdef _WIN32
 #include <fcntl.h>
 #include <io.h>
 #include <stdio.h>
 #define SET_STDIN_BINARY_MODE() _setmode(_fileno(stdin), O_BINARY)
+#define SET_STDOUT_BINARY_MODE() _setmode(_fileno(stdout), O_BINARY)
 #else
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
 #define SET_STDIN_BINARY_MODE() ((void)0)
+#define SET_STDOUT_BINARY_MODE() ((void)0)
 #endif
 
 namespace fs = std::filesystem;
@@ -76,6 +90,63 @@ f3d::interactor* GlobalInteractor = nullptr;
 
 constexpr std::string_view F3D_PIPED = "-";
 
+#ifndef _WIN32
+/**
+ * A minimal unbuffered output, buffered input, stream buffer over a connected socket,
+ * used to serve requests with the same code as the standard input and output.
+ */
+class F3DSocketStreamBuffer : public std::streambuf
+{
+public:
+  explicit F3DSocketStreamBuffer(int fd)
+    : FileDescriptor(fd)
+  {
+    this->setg(this->Input.data(), this->Input.data(), this->Input.data());
+  }
+
+protected:
+  int_type underflow() override
+  {
+    const ssize_t count = ::read(this->FileDescriptor, this->Input.data(), this->Input.size());
+    if (count <= 0)
+    {
+      return traits_type::eof();
+    }
+    this->setg(this->Input.data(), this->Input.data(), this->Input.data() + count);
+    return traits_type::to_int_type(this->Input[0]);
+  }
+
+  std::streamsize xsputn(const char* data, std::streamsize size) override
+  {
+    std::streamsize written = 0;
+    while (written < size)
+    {
+      const ssize_t count = ::write(this->FileDescriptor, data + written, size - written);
+      if (count <= 0)
+      {
+        break;
+      }
+      written += count;
+    }
+    return written;
+  }
+
+  int_type overflow(int_type c) override
+  {
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      return traits_type::not_eof(c);
+    }
+    const char character = traits_type::to_char_type(c);
+    return this->xsputn(&character, 1) == 1 ? c : traits_type::eof();
+  }
+
+private:
+  int FileDescriptor;
+  std::array<char, 4096> Input;
+};
+#endif
+
 class F3DStarter::F3DInternals
 {
 public:
@@ -101,6 +172,8 @@ public:
   struct F3DAppOptions
   {
     std::string Output;
+    bool OutputAllGroups;
+    std::string Server;
     std::string LoadStatefile;
     std::string SaveStatefile;
     std::string StatefileFilename;
@@ -112,6 +185,7 @@ public:
     std::optional<double> AnimationTime;
     bool Watch;
     double FrameRate;
+    int OutputViews;
     std::vector<std::string> Plugins;
     std::string PluginsPath;
     std::string ScreenshotFilename;
@@ -479,19 +553,28 @@ public:
   {
     F3DStarter* self = reinterpret_cast<F3DStarter*>(userData);
     const std::lock_guard<std::mutex> lock(self->Internals->FilesToWatchMutex);
-    if (std::ranges::find_if(self->Internals->FilesToWatch, [&](const auto& path)
-          { return path.filename() == filename; }) != self->Internals->FilesToWatch.end())
+    for (const fs::path& path : self->Internals->FilesToWatch)
     {
-      self->Internals->ReloadFileRequested = true;
+      if (path.filename() == filename)
+      {
+        // Record the changed file, the reload is performed by the event loop once changes settle
+        self->Internals->FilesToReload.insert(path);
+        self->Internals->LastFileChangeTime = std::chrono::steady_clock::now();
+        self->Internals->ReloadFileRequested = true;
+      }
     }
   }
 #endif
 
   void addOutputImageMetadata(f3d::image& image)
+  {
+    addOutputImageMetadata(image, Engine->getWindow().getCamera().getState());
+  }
+
+  void addOutputImageMetadata(f3d::image& image, const f3d::camera_state_t& state)
   {
     std::stringstream cameraMetadata;
     {
-      const auto state = Engine->getWindow().getCamera().getState();
       const auto vec3toJson = [](const std::array<double, 3>& v)
       {
         std::stringstream ss;
@@ -518,30 +601,444 @@ public:
   {
     f3d::image img = window.renderToImage(AppOptions.NoBackground);
     addOutputImageMetadata(img);
+    return saveImage(img, outputTemplate, toStdout, frame);
+  }
+
+  /**
+   * Render the provided number of views rotating around the model and save them to files
+   * or stdout, substituting the `{view}` variable, and the `{frame}` variable if provided.
+   * Views are rendered in a single batch sharing the rendering state.
+   * Returns true on success, false on failure (error already logged).
+   */
+  bool renderViewsAndSave(f3d::window& window, const f3d::utils::string_template& outputTemplate,
+    bool toStdout, int count, std::optional<int> frame = std::nullopt)
+  {
+    f3d::camera& camera = window.getCamera();
+    const f3d::camera_state_t initialState = camera.getState();
+
+    std::vector<f3d::camera_state_t> states;
+    states.reserve(count);
+    for (int view = 0; view < count; ++view)
+    {
+      camera.setState(initialState);
+      camera.azimuth(view * 360.0 / count);
+      states.emplace_back(camera.getState());
+    }
+    camera.setState(initialState);
+
+    std::vector<f3d::image> images = window.renderViews(states, AppOptions.NoBackground);
+    for (int view = 0; view < count; ++view)
+    {
+      addOutputImageMetadata(images[view], states[view]);
+      if (!saveImage(images[view], outputTemplate, toStdout, frame, view))
+      {
+        return false;
+      }
+    }
+    return this->waitPendingSave();
+  }
+
+  /**
+   * Render the currently loaded files and save the result using the output template,
+   * exporting multiple views and/or animation frames depending on the template variables.
+   * When both `{frame}` and `{view}` are used, all the views are exported for each frame.
+   * Returns true on success, false on failure (error already logged).
+   */
+  bool renderOutput(
+    f3d::window& window, const f3d::utils::string_template& outputTemplate, bool toStdout)
+  {
+    const bool hasViews = outputTemplate.hasVariable(std::regex("view(:.*)?"));
+    const bool hasFrames = outputTemplate.hasVariable(std::regex("frame(:.*)?"));
 
+    const int viewCount = this->AppOptions.OutputViews;
+    if (hasViews && viewCount < 1)
+    {
+      f3d::log::error("Invalid number of output views: ", viewCount);
+      return false;
+    }
+
+    if (hasFrames)
+    {
+      f3d::scene& animScene = this->Engine->getScene();
+      const auto [minTime, maxTime] = animScene.animationTimeRange();
+
+      const double startTime = this->AppOptions.AnimationTime.value_or(minTime);
+      const double endTime = maxTime;
+      const double duration = endTime - startTime;
+      const int count = duration > 0
+        ? static_cast<int>(std::ceil(duration * this->AppOptions.FrameRate)) + 1
+        : 1;
+
+      if (count == 1)
+      {
+        f3d::log::warn(
+          "No animation available or animation has zero duration, outputting single frame");
+      }
+
+      const double timeStep = 1.0 / this->AppOptions.FrameRate;
+
+      if (hasViews)
+      {
+        f3d::log::info("Saving ", count, " animation frame(s) of ", viewCount,
+          " view(s) from time ", startTime, " to ", endTime);
+      }
+      else
+      {
+        f3d::log::info(
+          "Saving ", count, " animation frame(s) from time ", startTime, " to ", endTime);
+      }
+
+      const size_t savedImages = this->SavedImages;
+      for (int frame = 0; frame < count; ++frame)
+      {
+        const double currentTime = startTime + frame * timeStep;
+        animScene.loadAnimationTime(currentTime);
+
+        const bool saved = hasViews
+          ? this->renderViewsAndSave(window, outputTemplate, toStdout, viewCount, frame)
+          : this->renderAndSave(window, outputTemplate, toStdout, frame);
+        if (!saved)
+        {
+          return false;
+        }
+      }
+
+      // Only count the images that are actually written
+      if (!this->waitPendingSave())
+      {
+        return false;
+      }
+      if (hasViews)
+      {
+        f3d::log::info("Saved ", this->SavedImages - savedImages, " image(s)");
+      }
+      else
+      {
+        f3d::log::info("Saved ", this->SavedImages - savedImages, " animation frame(s)");
+      }
+    }
+    else if (hasViews)
+    {
+      f3d::log::info("Saving ", viewCount, " view(s)");
+      const size_t savedImages = this->SavedImages;
+      if (!this->renderViewsAndSave(window, outputTemplate, toStdout, viewCount))
+      {
+        return false;
+      }
+      f3d::log::info("Saved ", this->SavedImages - savedImages, " view(s)");
+    }
+    else
+    {
+      return this->renderAndSave(window, outputTemplate, toStdout);
+    }
+    return true;
+  }
+
+  /**
+   * Serve the requests read from `input`, one per line, and write the responses to `output`.
+   * Supported requests are:
+   * - `render`: respond with `image <size>` followed by the PNG encoded image
+   * - `render_raw`: respond with `raw <width> <height> <components> <size>` followed by the
+   *   pixels, bottom row first
+   * - `dump_state`: respond with `state <size>` followed by the JSON engine state
+   * - `load_state <json>`: restore the engine state from a single line JSON string
+   * - `exit`: stop the server
+   * - any other line is triggered as a command, eg: `add_files`, `set`, `set_camera`
+   * Other responses are `ok` or `error <message>`, requests are answered in order.
+   * Returns true when the `exit` request was received, false when the input was closed.
+   */
+  bool serveRequests(
+    f3d::interactor& interactor, f3d::window& window, std::istream& input, std::ostream& output)
+  {
+    std::string request;
+    while (std::getline(input, request))
+    {
+      if (!request.empty() && request.back() == '\r')
+      {
+        request.pop_back();
+      }
+      if (request.empty())
+      {
+        continue;
+      }
+
+      const std::string name = request.substr(0, request.find(' '));
+      try
+      {
+        if (name == "exit")
+        {
+          output << "ok\n" << std::flush;
+          return true;
+        }
+        else if (name == "render")
+        {
+          f3d::image img = window.renderToImage(this->AppOptions.NoBackground);
+          this->addOutputImageMetadata(img);
+          const std::vector<unsigned char> buffer = img.saveBuffer();
+          output << "image " << buffer.size() << "\n";
+          output.write(reinterpret_cast<const char*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size()));
+        }
+        else if (name == "render_raw")
+        {
+          const size_t width = static_cast<size_t>(window.getWidth());
+          const size_t height = static_cast<size_t>(window.getHeight());
+          const size_t components = this->AppOptions.NoBackground ? 4 : 3;
+
+          // Reuse the buffer between requests to avoid allocating every frame
+          this->ServerBuffer.resize(width * height * components);
+          if (!window.renderToBuffer(this->ServerBuffer.data(), this->ServerBuffer.size(), 0,
+                this->AppOptions.NoBackground))
+          {
+            output << "error could not render the window\n" << std::flush;
+            continue;
+          }
+          output << "raw " << width << " " << height << " " << components << " "
+                 << this->ServerBuffer.size() << "\n";
+          output.write(reinterpret_cast<const char*>(this->ServerBuffer.data()),
+            static_cast<std::streamsize>(this->ServerBuffer.size()));
+        }
+        else if (name == "dump_state")
+        {
+          const std::string content = this->Engine->dump().toString();
+          output << "state " << content.size() << "\n" << content;
+        }
+        else if (name == "load_state")
+        {
+          this->Engine->load(f3d::engine::state::fromString(request.substr(name.size())));
+          output << "ok\n";
+        }
+        else if (interactor.triggerCommand(request))
+        {
+          output << "ok\n";
+        }
+        else
+        {
+          output << "error invalid command: " << name << "\n";
+        }
+      }
+      catch (const std::exception& ex)
+      {
+        std::string message = ex.what();
+        std::ranges::replace(message, '\n', ' ');
+        output << "error " << message << "\n";
+      }
+      output.flush();
+    }
+    return false;
+  }
+
+  /**
+   * Run the render server, reading requests from the standard input and writing responses to
+   * the standard output when `source` is `-`, or serving the clients connecting one after the
+   * other to the Unix socket at the `source` path otherwise.
+   * Returns true on success, false on failure (error already logged).
+   */
+  bool runServer(f3d::interactor& interactor, f3d::window& window, const std::string& source)
+  {
+    if (source == F3D_PIPED)
+    {
+      SET_STDIN_BINARY_MODE();
+      SET_STDOUT_BINARY_MODE();
+      f3d::log::debug("Serving requests from the standard input");
+      this->serveRequests(interactor, window, std::cin, std::cout);
+      return true;
+    }
+
+#ifdef _WIN32
+    f3d::log::error("Unix socket server is not supported on this platform, use --server=-");
+    return false;
+#else
+    const fs::path socketPath = f3d::utils::collapsePath(source);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.string().size() >= sizeof(address.sun_path))
+    {
+      f3d::log::error("Server socket path is too long: ", socketPath);
+      return false;
+    }
+    std::copy_n(socketPath.string().c_str(), socketPath.string().size() + 1, address.sun_path);
+
+    // Only replace a socket left by a previous server, never another kind of file
+    struct stat status;
+    if (::lstat(socketPath.c_str(), &status) == 0)
+    {
+      if (!S_ISSOCK(status.st_mode))
+      {
+        f3d::log::error("Server socket path exists and is not a socket: ", socketPath);
+        return false;
+      }
+      ::unlink(socketPath.c_str());
+    }
+
+    const int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+      f3d::log::error("Could not create the server socket");
+      return false;
+    }
+
+    // A disconnected client must not terminate the server
+    std::signal(SIGPIPE, SIG_IGN);
+
+    // Only the current user can connect to the server, the socket is created with 0600
+    const mode_t previousMask = ::umask(0077);
+    const bool bound =
+      ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    ::umask(previousMask);
+    if (!bound || ::listen(listenFd, 1) != 0)
+    {
+      f3d::log::error("Could not listen on the server socket: ", socketPath);
+      ::close(listenFd);
+      return false;
+    }
+
+    f3d::log::info("Serving requests on ", socketPath);
+    bool exitRequested = false;
+    while (!exitRequested)
+    {
+      const int clientFd = ::accept(listenFd, nullptr, nullptr);
+      if (clientFd < 0)
+      {
+        f3d::log::error("Could not accept a connection on the server socket");
+        break;
+      }
+
+      F3DSocketStreamBuffer buffer(clientFd);
+      std::iostream stream(&buffer);
+      exitRequested = this->serveRequests(interactor, window, stream, stream);
+      ::close(clientFd);
+    }
+
+    ::close(listenFd);
+    ::unlink(socketPath.c_str());
+    return exitRequested;
+#endif
+  }
+
+  /**
+   * Save an image to file or stdout.
+   * Returns true on success, false on failure (error already logged).
+   */
+  bool saveImage(const f3d::image& img, const f3d::utils::string_template& outputTemplate,
+    bool toStdout, std::optional<int> frame = std::nullopt, std::optional<int> view = std::nullopt)
+  {
     if (toStdout)
     {
       const auto buffer = img.saveBuffer();
       std::copy(buffer.begin(), buffer.end(), std::ostreambuf_iterator(std::cout));
       f3d::log::debug("Output image saved to stdout");
+      this->SavedImages++;
     }
     else
     {
-      const fs::path outputPath = finalizeFilenameTemplate(outputTemplate, frame);
-      try
+      // Wait for the previous image to be written so that `{n}` takes it into account
+      if (!this->waitPendingSave())
       {
-        img.save(outputPath);
+        return false;
       }
-      catch (const f3d::image::write_exception& ex)
+
+      const fs::path outputPath = finalizeFilenameTemplate(outputTemplate, frame, false, view);
+      if (this->AsyncSave)
       {
-        f3d::log::error("Could not write output: ", ex.what());
-        return false;
+        // VTK is not thread safe and keeps being used to produce the next image, so the image
+        // is encoded on this thread and only the encoded bytes are written in the background.
+        // The result is logged from this thread when waiting for it
+        std::vector<unsigned char> buffer;
+        try
+        {
+          buffer = img.saveBuffer();
+        }
+        catch (const f3d::image::write_exception& ex)
+        {
+          return this->reportWrite(ex.what(), outputPath);
+        }
+        this->PendingSavePath = outputPath;
+        this->PendingSave = std::async(std::launch::async,
+          [buffer = std::move(buffer), outputPath]() { return writeBuffer(buffer, outputPath); });
+      }
+      else
+      {
+        return this->reportWrite(writeImage(img, outputPath), outputPath);
       }
-      f3d::log::debug("Output image saved to ", outputPath);
     }
     return true;
   }
 
+  /**
+   * Write an image to a file.
+   * Returns an empty string on success, the error message on failure.
+   */
+  static std::string writeImage(const f3d::image& img, const fs::path& outputPath)
+  {
+    try
+    {
+      img.save(outputPath);
+    }
+    catch (const f3d::image::write_exception& ex)
+    {
+      return ex.what();
+    }
+    return {};
+  }
+
+  /**
+   * Write an encoded image to a file, without logging nor using VTK so that it can be called
+   * from any thread.
+   * Returns an empty string on success, the error message on failure.
+   */
+  static std::string writeBuffer(
+    const std::vector<unsigned char>& buffer, const fs::path& outputPath)
+  {
+    try
+    {
+      const fs::path parent = outputPath.parent_path();
+      if (!parent.empty())
+      {
+        fs::create_directories(parent);
+      }
+    }
+    catch (const fs::filesystem_error& ex)
+    {
+      return std::string("Cannot write image: ") + ex.what();
+    }
+
+    std::ofstream file(outputPath, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    if (!file)
+    {
+      return "Cannot write image " + outputPath.string();
+    }
+    return {};
+  }
+
+  /**
+   * Log the result of writeImage or writeBuffer and count the successfully written images.
+   * Returns true on success, false on failure.
+   */
+  bool reportWrite(const std::string& error, const fs::path& outputPath)
+  {
+    if (!error.empty())
+    {
+      f3d::log::error("Could not write output: ", error);
+      return false;
+    }
+    f3d::log::debug("Output image saved to ", outputPath);
+    this->SavedImages++;
+    return true;
+  }
+
+  /**
+   * Wait for the image being written in the background, if any.
+   * Returns true on success or if there was nothing to wait for, false on failure.
+   */
+  bool waitPendingSave()
+  {
+    return this->PendingSave.valid()
+      ? this->reportWrite(this->PendingSave.get(), this->PendingSavePath)
+      : true;
+  }
+
   /**
    * Create a filename template and substitute the following variables:
    * - `{app}`: application name (ie. `F3D`)
@@ -647,17 +1144,41 @@ public:
    * Substitute the following variables and return as an `fs::path`
    * - `{frame}`: current animation frame number (when outputting multiple frames)
    * - `{frame:2}`, `{frame:3}`, ...: zero-padded animation frame number
+   * - `{view}`: current view number (when outputting multiple views)
+   * - `{view:2}`, `{view:3}`, ...: zero-padded view number
    * - `{n}`: auto-incremented number to make filename unique (up to 1000000)
    * - `{n:2}`, `{n:3}`, ...: zero-padded auto-incremented number to make filename unique
    *   (up to 1000000)
    */
   fs::path finalizeFilenameTemplate(f3d::utils::string_template stringTemplate,
-    std::optional<int> frame = std::nullopt, bool existing = false)
+    std::optional<int> frame = std::nullopt, bool existing = false,
+    std::optional<int> view = std::nullopt)
   {
     const std::regex frameRe("frame(:(.*))?");
+    const std::regex viewRe("view(:(.*))?");
     const std::regex numberingRe("n(:(.*))?");
     constexpr size_t maxNumberingAttempts = 1000000;
 
+    const auto formatIndex =
+      [](const std::string& var, const std::regex& re, const std::string& name, int index)
+    {
+      std::stringstream formattedIndex;
+      const std::string fmt = std::regex_replace(var, re, "$2");
+      try
+      {
+        formattedIndex << std::setfill('0') << std::setw(std::stoi(fmt)) << index;
+      }
+      catch (std::invalid_argument&)
+      {
+        if (!fmt.empty())
+        {
+          f3d::log::warn("ignoring invalid ", name, " format for \"", var, "\"");
+        }
+        formattedIndex << std::setw(0) << index;
+      }
+      return formattedIndex.str();
+    };
+
     const auto variableLookup = [&](const std::string& var)
     {
       if (std::regex_match(var, frameRe))
@@ -667,21 +1188,16 @@ public:
           f3d::log::warn("{frame} variable can only be used when outputting animation frames");
           throw f3d::utils::string_template::lookup_error(var);
         }
-        std::stringstream formattedFrame;
-        const std::string fmt = std::regex_replace(var, frameRe, "$2");
-        try
-        {
-          formattedFrame << std::setfill('0') << std::setw(std::stoi(fmt)) << frame.value();
-        }
-        catch (std::invalid_argument&)
+        return formatIndex(var, frameRe, "frame", frame.value());
+      }
+      if (std::regex_match(var, viewRe))
+      {
+        if (!view.has_value())
         {
-          if (!fmt.empty())
-          {
-            f3d::log::warn("ignoring invalid frame format for \"", var, "\"");
-          }
-          formattedFrame << std::setw(0) << frame.value();
+          f3d::log::warn("{view} variable can only be used when outputting views");
+          throw f3d::utils::string_template::lookup_error(var);
         }
-        return formattedFrame.str();
+        return formatIndex(var, viewRe, "view", view.value());
       }
       throw f3d::utils::string_template::lookup_error(var);
     };
@@ -737,43 +1253,124 @@ public:
       std::to_string(maxNumberingAttempts) + " attempts");
   }
 
-  static bool PatternMatched(const std::string& source, const std::string& matchType,
-    const std::string& match, const std::string& inputFile)
+  // A config block pattern, compiled once and reused for every file and every update
+  struct CompiledPattern
+  {
+    enum class Type
+    {
+      Exact,
+      Extensions,
+      Regex,
+      Invalid
+    };
+
+    Type PatternType = Type::Invalid;
+    std::vector<std::string> Extensions; // lower case, including the dot
+    std::regex Regex;
+  };
+
+  // Recover the extensions of a glob pattern of the form `*.ext` or `*.{ext1,ext2}`, the most
+  // common config blocks, which can be matched without a regex
+  static bool ParseExtensionsGlob(const std::string& glob, std::vector<std::string>& extensions)
+  {
+    if (!glob.starts_with("*."))
+    {
+      return false;
+    }
+
+    // Like globToRegex, only the commas of a `{...}` group separate alternatives, any other
+    // comma is a literal character of the extension, which is then rejected below
+    std::string_view list = std::string_view(glob).substr(2);
+    const bool group = list.starts_with('{') && list.ends_with('}');
+    if (group)
+    {
+      list = list.substr(1, list.size() - 2);
+    }
+
+    extensions.clear();
+    size_t start = 0;
+    while (start <= list.size())
+    {
+      size_t end = group ? std::min(list.find(',', start), list.size()) : list.size();
+      std::string extension = "." + std::string(list.substr(start, end - start));
+      if (extension.size() == 1 ||
+        !std::all_of(extension.begin() + 1, extension.end(),
+          [](unsigned char c) { return std::isalnum(c) || c == '_'; }))
+      {
+        return false;
+      }
+      std::ranges::transform(
+        extension, extension.begin(), [](unsigned char c) { return std::tolower(c); });
+      extensions.emplace_back(std::move(extension));
+      start = end + 1;
+    }
+    return true;
+  }
+
+  const CompiledPattern& CompilePattern(
+    const std::string& source, const std::string& matchType, const std::string& match)
   {
-    static std::set<std::string> erroredPatterns;
+    const std::string key = matchType + ":" + match;
+    if (auto it = this->CompiledPatterns.find(key); it != this->CompiledPatterns.end())
+    {
+      return it->second;
+    }
+
+    CompiledPattern pattern;
     if (matchType == "exact")
     {
-      return match == inputFile;
+      pattern.PatternType = CompiledPattern::Type::Exact;
+    }
+    else if (matchType == "glob" && F3DInternals::ParseExtensionsGlob(match, pattern.Extensions))
+    {
+      pattern.PatternType = CompiledPattern::Type::Extensions;
     }
     else
     {
       try
       {
-        std::regex re(matchType == "glob"
+        pattern.Regex = std::regex(matchType == "glob"
             ? f3d::utils::globToRegex(match, fs::path::preferred_separator)
             : match,
           std::regex_constants::icase);
-        return std::regex_match(inputFile, re);
+        pattern.PatternType = CompiledPattern::Type::Regex;
       }
       catch (const f3d::utils::glob_exception& ex)
       {
-        if (auto [it, inserted] = erroredPatterns.emplace(match); inserted)
-        {
-          f3d::log::error("There was an error in the config ", source, " for glob pattern `", match,
-            "`: ", ex.what());
-        }
-        return false;
+        f3d::log::error("There was an error in the config ", source, " for glob pattern `", match,
+          "`: ", ex.what());
       }
       catch (const std::regex_error& ex)
       {
-        if (auto [it, inserted] = erroredPatterns.emplace(match); inserted)
-        {
-          f3d::log::error("There was an error in the config ", source, " for ", matchType,
-            " pattern `", match, "`: ", ex.what());
-        }
-        return false;
+        f3d::log::error("There was an error in the config ", source, " for ", matchType,
+          " pattern `", match, "`: ", ex.what());
       }
     }
+    return this->CompiledPatterns.emplace(key, std::move(pattern)).first->second;
+  }
+
+  bool PatternMatched(const std::string& source, const std::string& matchType,
+    const std::string& match, const std::string& inputFile)
+  {
+    const CompiledPattern& pattern = this->CompilePattern(source, matchType, match);
+    switch (pattern.PatternType)
+    {
+      case CompiledPattern::Type::Exact:
+        return match == inputFile;
+      case CompiledPattern::Type::Extensions:
+        return std::ranges::any_of(pattern.Extensions,
+          [&](const std::string& extension)
+          {
+            return inputFile.size() >= extension.size() &&
+              std::equal(extension.begin(), extension.end(),
+                inputFile.end() - static_cast<std::ptrdiff_t>(extension.size()),
+                [](char e, unsigned char c) { return e == std::tolower(c); });
+          });
+      case CompiledPattern::Type::Regex:
+        return std::regex_match(inputFile, pattern.Regex);
+      default:
+        return false;
+    }
   }
 
   static std::string FormatOrigin(
@@ -837,7 +1434,7 @@ public:
         {
           // If the source is empty, there is no pattern, all options applies
           // Note: An empty inputFile matches with ".*"
-          if (source.empty() || F3DInternals::PatternMatched(source, matchType, match, inputFile))
+          if (source.empty() || this->PatternMatched(source, matchType, match, inputFile))
           {
             // For each option key/value
             for (auto const& [key, value] : conf)
@@ -949,7 +1546,8 @@ public:
     // Update Verbose level as soon as possible, redirecting logs to stderr whenever data is
     // written to stdout so it stays usable when piped
     F3DInternals::SetVerboseLevel(this->AppOptions.VerboseLevel,
-      this->AppOptions.Output == F3D_PIPED || this->AppOptions.SaveStatefile == F3D_PIPED);
+      this->AppOptions.Output == F3D_PIPED || this->AppOptions.SaveStatefile == F3D_PIPED ||
+        this->AppOptions.Server == F3D_PIPED);
 
     // Load any new plugins
     F3DPluginsTools::LoadPlugins(this->AppOptions.Plugins, this->AppOptions.PluginsPath);
@@ -1002,6 +1600,8 @@ public:
   {
     // Update typed app options from app options
     this->ParseOption(appOptions, "output", this->AppOptions.Output);
+    this->ParseOption(appOptions, "output-all-groups", this->AppOptions.OutputAllGroups);
+    this->ParseOption(appOptions, "server", this->AppOptions.Server);
     this->ParseOption(appOptions, "load-statefile", this->AppOptions.LoadStatefile);
     this->ParseOption(appOptions, "save-statefile", this->AppOptions.SaveStatefile);
     this->ParseOption(appOptions, "statefile-filename", this->AppOptions.StatefileFilename);
@@ -1012,6 +1612,7 @@ public:
     this->ParseOption(appOptions, "max-size", this->AppOptions.MaxSize);
     this->ParseOption(appOptions, "animation-time", this->AppOptions.AnimationTime);
     this->ParseOption(appOptions, "frame-rate", this->AppOptions.FrameRate);
+    this->ParseOption(appOptions, "output-views", this->AppOptions.OutputViews);
     this->ParseOption(appOptions, "watch", this->AppOptions.Watch);
     this->ParseOption(appOptions, "load-plugins", this->AppOptions.Plugins);
     this->ParseOption(appOptions, "plugins-path", this->AppOptions.PluginsPath);
@@ -1199,7 +1800,7 @@ public:
         {
           // If the source is empty, there is no pattern, all bindings applies
           // Note: An empty inputFile matches with ".*"
-          if (source.empty() || F3DInternals::PatternMatched(source, matchType, match, inputFile))
+          if (source.empty() || this->PatternMatched(source, matchType, match, inputFile))
           {
             // For each interaction bindings
             for (auto const& [bindStr, commands] : bindings)
@@ -1222,6 +1823,170 @@ public:
     }
   }
 
+  // Compute a key to identify the group a file should go in
+  std::string GetFilesGroupKey(const fs::path& path)
+  {
+    // XXX more multi-file mode may be added in the future
+    std::string pathString = path.string();
+    if (!this->AppOptions.MultiFileRegex.empty())
+    {
+      // Compile the regex once, not for every added file
+      if (this->MultiFileRegexSource != this->AppOptions.MultiFileRegex)
+      {
+        this->MultiFileRegex = std::regex(this->AppOptions.MultiFileRegex);
+        this->MultiFileRegexSource = this->AppOptions.MultiFileRegex;
+      }
+
+      std::smatch match;
+      if (std::regex_search(pathString, match, this->MultiFileRegex))
+      {
+        // Replace captured groups with `*` so that, for example,
+        // `"foo-part12.xyz"` matching `part(\d+)` becomes `"foo-part*.xyz"`
+        std::stringstream groupKey;
+        size_t j = 0;
+        for (size_t i = 1; i <= this->MultiFileRegex.mark_count(); ++i)
+        {
+          if (match.length(i) &&                                 // skip empty
+            match.position(i) >= static_cast<std::ptrdiff_t>(j)) // or nested groups
+          {
+            groupKey << pathString.substr(j, match.position(i) - j) << "*";
+            j = match.position(i) + match.length(i);
+          }
+        }
+        groupKey << pathString.substr(j);
+        return groupKey.str();
+      }
+    }
+    if (this->AppOptions.MultiFileMode == "all")
+    {
+      return std::string("");
+    }
+    if (this->AppOptions.MultiFileMode == "dir")
+    {
+      return path.parent_path().string();
+    }
+    return pathString;
+  }
+
+  // Add a file to the group matching its key, creating the group if needed,
+  // and return the index of the group
+  int AddToFilesGroup(const fs::path& path)
+  {
+    // Groups and their files are indexed so adding a file does not scan all the groups
+    if (this->FilesGroupsIndexOutdated)
+    {
+      this->FilesGroupsIndex.clear();
+      this->FilesGroupsFiles.clear();
+      for (const auto& [key, paths] : this->FilesGroups)
+      {
+        this->FilesGroupsIndex.emplace(key, this->FilesGroupsFiles.size());
+        auto& files = this->FilesGroupsFiles.emplace_back();
+        for (const fs::path& groupPath : paths)
+        {
+          files.insert(groupPath.string());
+        }
+      }
+      this->FilesGroupsIndexOutdated = false;
+    }
+
+    const std::string groupKey = this->GetFilesGroupKey(path);
+    const auto [it, inserted] = this->FilesGroupsIndex.emplace(groupKey, this->FilesGroups.size());
+    if (inserted)
+    {
+      // Create new group
+      this->FilesGroups.emplace_back(groupKey, std::vector<fs::path>({ path }));
+      this->FilesGroupsFiles.emplace_back().insert(path.string());
+    }
+    else if (this->FilesGroupsFiles[it->second].insert(path.string()).second)
+    {
+      // File has not already been added
+      this->FilesGroups[it->second].second.emplace_back(path);
+    }
+    return static_cast<int>(it->second);
+  }
+
+  // List the regular files of a directory, and of its subdirectories if recursive, in the order
+  // of a depth first traversal of the sorted entries of each directory.
+  // Subdirectories are listed in parallel and file types come from the listing, so no file is
+  // stat'ed before being loaded. Errors in subdirectories are logged unless quiet.
+  static std::vector<fs::path> ListDirectoryFiles(
+    const fs::path& directory, bool recursive, bool quiet)
+  {
+    struct Listing
+    {
+      std::vector<fs::path> Files;
+      std::vector<fs::path> Directories;
+    };
+
+    const auto list = [recursive](const fs::path& dir, Listing& listing)
+    {
+      for (const auto& entry : fs::directory_iterator(dir))
+      {
+        if (entry.is_regular_file())
+        {
+          listing.Files.emplace_back(entry.path());
+        }
+        else if (recursive && entry.is_directory())
+        {
+          listing.Directories.emplace_back(entry.path());
+        }
+      }
+    };
+
+    // Errors listing the directory itself are reported to the caller
+    Listing listing;
+    list(directory, listing);
+
+    std::vector<fs::path> files = std::move(listing.Files);
+    std::vector<fs::path> directories = std::move(listing.Directories);
+    while (!directories.empty())
+    {
+      const size_t nbTasks = std::min<size_t>(
+        directories.size(), std::max(1u, std::thread::hardware_concurrency()));
+      std::vector<std::future<std::pair<Listing, std::vector<std::string>>>> tasks;
+      for (size_t task = 0; task < nbTasks; task++)
+      {
+        tasks.emplace_back(std::async(std::launch::async,
+          [&, task]()
+          {
+            std::pair<Listing, std::vector<std::string>> result;
+            for (size_t i = task; i < directories.size(); i += nbTasks)
+            {
+              try
+              {
+                list(directories[i], result.first);
+              }
+              catch (const fs::filesystem_error& ex)
+              {
+                result.second.emplace_back(ex.what());
+              }
+            }
+            return result;
+          }));
+      }
+
+      std::vector<fs::path> subdirectories;
+      for (auto& task : tasks)
+      {
+        auto [taskListing, errors] = task.get();
+        std::ranges::move(taskListing.Files, std::back_inserter(files));
+        std::ranges::move(taskListing.Directories, std::back_inserter(subdirectories));
+        for (const std::string& error : errors)
+        {
+          if (!quiet)
+          {
+            f3d::log::error("Error adding file: ", error);
+          }
+        }
+      }
+      directories = std::move(subdirectories);
+    }
+
+    // Paths are compared element-wise so sorting all of them gives the traversal order
+    std::ranges::sort(files);
+    return files;
+  }
+
   // Recover a set of parent paths from paths
   template<typename T>
   static std::set<fs::path> ParentPaths(const T& paths)
@@ -1346,6 +2111,17 @@ public:
   std::unique_ptr<f3d::engine> Engine;
   std::vector<std::pair<std::string, std::vector<fs::path>>> FilesGroups;
   std::vector<fs::path> LoadedFiles;
+
+  // Index of FilesGroups by key and files of each group, rebuilt when FilesGroups is modified
+  // other than by AddToFilesGroup
+  std::unordered_map<std::string, size_t> FilesGroupsIndex;
+  std::vector<std::unordered_set<std::string>> FilesGroupsFiles;
+  bool FilesGroupsIndexOutdated = false;
+  std::string MultiFileRegexSource;
+  std::regex MultiFileRegex;
+
+  // Config block patterns by match type and match
+  std::unordered_map<std::string, CompiledPattern> CompiledPatterns;
   std::set<fs::path> FilesToWatch;
   int CurrentFilesGroupIndex = -1;
   std::vector<std::byte> PipedBuffer;
@@ -1356,6 +2132,21 @@ public:
   std::map<fs::path, dmon_watch_id> FolderWatchIds;
 #endif
 
+  // Watched files that changed since the last reload, guarded by FilesToWatchMutex
+  std::set<fs::path> FilesToReload;
+  std::chrono::steady_clock::time_point LastFileChangeTime;
+
+  // Output image written in the background when outputting all file groups
+  bool AsyncSave = false;
+  std::future<std::string> PendingSave;
+  fs::path PendingSavePath;
+
+  // Number of output images successfully saved
+  size_t SavedImages = 0;
+
+  // Raw pixels buffer reused between render server requests
+  std::vector<unsigned char> ServerBuffer;
+
   // Event loop atomics
   std::atomic<bool> ReloadFileRequested = false;
 };
@@ -1441,6 +2232,17 @@ int F3DStarter::Start(int argc, char** argv)
     statefileToStdout = localSaveStatefile == F3D_PIPED;
   }
 
+  // Server responses are written to stdout when serving the standard input
+  bool serveStdin = false;
+  iter = cliOptionsDict.find("server");
+  if (iter != cliOptionsDict.end())
+  {
+    std::string localServer;
+    // XXX: Discarding bool return because this cannot return false with a string
+    F3DOptionsTools::Parse(iter->second, localServer);
+    serveStdin = localServer == F3D_PIPED;
+  }
+
   this->Internals->AppOptions.VerboseLevel = "info";
   iter = cliOptionsDict.find("verbose");
   if (iter != cliOptionsDict.end())
@@ -1452,7 +2254,7 @@ int F3DStarter::Start(int argc, char** argv)
   // Set verbosity level early from command line, redirecting logs to stderr whenever data is
   // written to stdout so it stays usable when piped
   F3DInternals::SetVerboseLevel(
-    this->Internals->AppOptions.VerboseLevel, renderToStdout || statefileToStdout);
+    this->Internals->AppOptions.VerboseLevel, renderToStdout || statefileToStdout || serveStdin);
 
   f3d::log::debug("========== Initializing Options ==========");
 
@@ -1540,7 +2342,8 @@ int F3DStarter::Start(int argc, char** argv)
   else
   {
     bool offscreen = !this->Internals->AppOptions.Reference.empty() ||
-      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList;
+      !this->Internals->AppOptions.Output.empty() || !this->Internals->AppOptions.Server.empty() ||
+      this->Internals->AppOptions.BindingsList;
 
     try
     {
@@ -1593,7 +2396,7 @@ int F3DStarter::Start(int argc, char** argv)
     this->ResetWindowName();
 
     if (!this->Internals->AppOptions.NoRender && this->Internals->AppOptions.Output.empty() &&
-      this->Internals->AppOptions.Reference.empty())
+      this->Internals->AppOptions.Reference.empty() && this->Internals->AppOptions.Server.empty())
     {
       const F3DOptionsTools::OptionsDict cachedGeometry =
         this->Internals->ReadCachedWindowGeometry();
@@ -1622,6 +2425,7 @@ int F3DStarter::Start(int argc, char** argv)
   if (statefileFileGroups.has_value())
   {
     this->Internals->FilesGroups = statefileFileGroups->Groups;
+    this->Internals->FilesGroupsIndexOutdated = true;
     statefileCurrentGroup = statefileFileGroups->Current;
   }
 
@@ -1849,6 +2653,14 @@ int F3DStarter::Start(int argc, char** argv)
                        "3D files were ignored.");
       }
     }
+    // Serve requests if needed
+    else if (!this->Internals->AppOptions.Server.empty())
+    {
+      if (!this->Internals->runServer(interactor, window, this->Internals->AppOptions.Server))
+      {
+        return EXIT_FAILURE;
+      }
+    }
     // Render to file if needed
     else if (!this->Internals->AppOptions.Output.empty())
     {
@@ -1858,54 +2670,64 @@ int F3DStarter::Start(int argc, char** argv)
         return EXIT_FAILURE;
       }
 
-      if (outputTemplate.hasVariable(std::regex("frame(:.*)?")))
+      const int groupCount = this->Internals->AppOptions.OutputAllGroups
+        ? static_cast<int>(this->Internals->FilesGroups.size())
+        : 1;
+      if (groupCount > 1)
       {
-        f3d::scene& animScene = this->Internals->Engine->getScene();
-        const auto [minTime, maxTime] = animScene.animationTimeRange();
-
-        const double startTime = this->Internals->AppOptions.AnimationTime.value_or(minTime);
-        const double endTime = maxTime;
-        const double duration = endTime - startTime;
-        const int count = duration > 0
-          ? static_cast<int>(std::ceil(duration * this->Internals->AppOptions.FrameRate)) + 1
-          : 1;
-
-        if (count == 1)
+        // Check the raw template, as the model variables are already substituted
+        const f3d::utils::string_template rawTemplate(this->Internals->AppOptions.Output);
+        if (!renderToStdout && !rawTemplate.hasVariable(std::regex("model(\\.ext|_ext)?|n(:.*)?")))
         {
-          f3d::log::warn("No animation available or animation has zero duration, outputting single "
-                         "frame");
+          f3d::log::warn("The output filename does not use the {model} or {n} variables, "
+                         "each file group will overwrite the output of the previous one");
         }
 
-        const double timeStep = 1.0 / this->Internals->AppOptions.FrameRate;
-
-        f3d::log::info(
-          "Saving ", count, " animation frame(s) from time ", startTime, " to ", endTime);
+        // Write images in the background while the next file group is loaded and rendered
+        this->Internals->AsyncSave = !renderToStdout;
+        f3d::log::info("Saving the output of ", groupCount, " file groups");
+      }
 
-        for (int frame = 0; frame < count; ++frame)
+      // Render every file group in turn, starting from the loaded one, reusing the engine
+      for (int group = 0; group < groupCount; ++group)
+      {
+        if (group > 0)
         {
-          const double currentTime = startTime + frame * timeStep;
-          animScene.loadAnimationTime(currentTime);
-
-          if (!this->Internals->renderAndSave(window, outputTemplate, renderToStdout, frame))
+          this->LoadFileGroup(1, true);
+          if (this->Internals->LoadedFiles.empty())
           {
-            return EXIT_FAILURE;
+            f3d::log::error("No files loaded for this file group, no rendering performed");
+            continue;
           }
         }
 
-        f3d::log::info("Saved ", count, " animation frame(s)");
-      }
-      else
-      {
-        if (!this->Internals->renderAndSave(window, outputTemplate, renderToStdout))
+        // The template is prepared again to substitute the variables of the loaded files
+        const f3d::utils::string_template groupTemplate = group > 0
+          ? this->Internals->prepareFilenameTemplate(
+              f3d::utils::collapsePath(this->Internals->AppOptions.Output))
+          : outputTemplate;
+        if (!this->Internals->renderOutput(window, groupTemplate, renderToStdout))
         {
+          // Report the image still being written, if any
+          this->Internals->waitPendingSave();
           return EXIT_FAILURE;
         }
       }
 
-      if (this->Internals->FilesGroups.size() > 1)
+      if (!this->Internals->waitPendingSave())
+      {
+        return EXIT_FAILURE;
+      }
+
+      if (groupCount > 1)
+      {
+        f3d::log::info("Saved ", this->Internals->SavedImages, " image(s) from ", groupCount,
+          " file groups");
+      }
+      else if (this->Internals->FilesGroups.size() > 1)
       {
         f3d::log::warn("An output image was saved using a single 3D file, other provided 3D "
-                       "files were ignored.");
+                       "files were ignored. Use --output-all-groups to render all of them.");
       }
     }
     // Start interaction
@@ -1983,6 +2805,7 @@ void F3DStarter::LoadFileGroup(int index, bool relativeIndex, bool forceClear)
     {
       this->Internals->FilesGroups.erase(
         this->Internals->FilesGroups.begin() + this->Internals->CurrentFilesGroupIndex);
+      this->Internals->FilesGroupsIndexOutdated = true;
       this->LoadRelativeFileGroup(0, false, true);
     }
   }
@@ -2605,10 +3428,12 @@ void F3DStarter::ApplyStatefile(const std::map<std::string, std::string>& statef
   }
 
   this->Internals->FilesGroups.clear();
+  this->Internals->FilesGroupsIndexOutdated = true;
   if (statefileFileGroups.has_value())
   {
     // Restore the exact file group structure, including groups that were not loaded
     this->Internals->FilesGroups = statefileFileGroups->Groups;
+    this->Internals->FilesGroupsIndexOutdated = true;
     const int size = static_cast<int>(this->Internals->FilesGroups.size());
     int current = statefileFileGroups->Current;
     if (current < 0 || current >= size)
@@ -2642,81 +3467,16 @@ int F3DStarter::AddFile(const fs::path& path, bool quiet)
     // If file is a directory, add files recursively
     if (fs::is_directory(tmpPath))
     {
-      std::set<fs::path> sortedPaths;
-      for (const auto& entry : fs::directory_iterator(tmpPath))
-      {
-        if (entry.is_regular_file() ||
-          (this->Internals->AppOptions.RecursiveDirAdd && entry.is_directory()))
-        {
-          sortedPaths.insert(entry.path());
-        }
-      }
-      for (const auto& entryPath : sortedPaths)
+      for (const auto& filePath : F3DInternals::ListDirectoryFiles(
+             tmpPath, this->Internals->AppOptions.RecursiveDirAdd, quiet))
       {
-        // Recursively add all files
-        this->AddFile(entryPath, quiet);
+        this->Internals->AddToFilesGroup(filePath);
       }
       return static_cast<int>(this->Internals->FilesGroups.size()) - 1;
     }
     else
     {
-      // Compute a key to identify the group the file should go in
-      const auto pathToGroupKey = [&]()
-      {
-        // XXX more multi-file mode may be added in the future
-        std::string tmpPathString = tmpPath.string();
-        if (!this->Internals->AppOptions.MultiFileRegex.empty())
-        {
-          const std::regex regex(this->Internals->AppOptions.MultiFileRegex);
-          std::smatch match;
-          if (std::regex_search(tmpPathString, match, regex))
-          {
-            // Replace captured groups with `*` so that, for example,
-            // `"foo-part12.xyz"` matching `part(\d+)` becomes `"foo-part*.xyz"`
-            std::stringstream groupKey;
-            size_t j = 0;
-            for (size_t i = 1; i <= regex.mark_count(); ++i)
-            {
-              if (match.length(i) &&                                 // skip empty
-                match.position(i) >= static_cast<std::ptrdiff_t>(j)) // or nested groups
-              {
-                groupKey << tmpPathString.substr(j, match.position(i) - j) << "*";
-                j = match.position(i) + match.length(i);
-              }
-            }
-            groupKey << tmpPathString.substr(j);
-            return groupKey.str();
-          }
-        }
-        if (this->Internals->AppOptions.MultiFileMode == "all")
-        {
-          return std::string("");
-        }
-        if (this->Internals->AppOptions.MultiFileMode == "dir")
-        {
-          return tmpPath.parent_path().string();
-        }
-        return tmpPathString;
-      };
-
-      const std::string groupKey = pathToGroupKey();
-      size_t groupIndex = 0;
-      for (auto& [key, paths] : this->Internals->FilesGroups)
-      {
-        if (key == groupKey)
-        {
-          // Check if file has already been added
-          if (std::ranges::find(paths, tmpPath) == paths.end())
-          {
-            paths.emplace_back(tmpPath);
-          }
-          return static_cast<int>(groupIndex);
-        }
-        ++groupIndex;
-      }
-      // Create new group if we haven't found one and returned already
-      this->Internals->FilesGroups.emplace_back(groupKey, std::vector<fs::path>({ tmpPath }));
-      return static_cast<int>(this->Internals->FilesGroups.size()) - 1;
+      return this->Internals->AddToFilesGroup(tmpPath);
     }
   }
   catch (const fs::filesystem_error& ex)
@@ -2755,9 +3515,59 @@ void F3DStarter::EventLoop()
 {
   if (this->Internals->ReloadFileRequested)
   {
-    this->LoadRelativeFileGroup(0, true, true);
-    this->Internals->ReloadFileRequested = false;
-    this->Internals->Engine->getInteractor().triggerNotification("File Group Reloaded");
+    // Editors and exporters usually write a file in multiple steps, wait for the changes to
+    // settle so that a burst of events only triggers a single reload
+    constexpr auto debounceDelay = std::chrono::milliseconds(200);
+
+    std::set<fs::path> filesToReload;
+    {
+#if F3D_MODULE_DMON
+      const std::lock_guard<std::mutex> lock(this->Internals->FilesToWatchMutex);
+#endif
+      if (std::chrono::steady_clock::now() - this->Internals->LastFileChangeTime < debounceDelay)
+      {
+        return;
+      }
+      filesToReload.swap(this->Internals->FilesToReload);
+      this->Internals->ReloadFileRequested = false;
+    }
+
+    // Only reload the changed files when they are all part of the scene already,
+    // otherwise the whole file group needs to be loaded again
+    const std::vector<fs::path>& loadedFiles = this->Internals->LoadedFiles;
+    bool reloadGroup = filesToReload.empty() ||
+      std::ranges::any_of(filesToReload, [&](const fs::path& path)
+        { return std::ranges::find(loadedFiles, path) == loadedFiles.end(); });
+
+    if (!reloadGroup)
+    {
+      f3d::scene& scene = this->Internals->Engine->getScene();
+      try
+      {
+        for (const fs::path& path : filesToReload)
+        {
+          scene.reload(path);
+        }
+
+        if (this->Internals->AppOptions.AnimationTime.has_value())
+        {
+          scene.loadAnimationTime(this->Internals->AppOptions.AnimationTime.value());
+        }
+        this->Internals->Engine->getInteractor().requestRender();
+        this->Internals->Engine->getInteractor().triggerNotification("File Reloaded");
+      }
+      catch (const f3d::scene::load_failure_exception& ex)
+      {
+        f3d::log::debug("Could not reload changed files, reloading the file group: ", ex.what());
+        reloadGroup = true;
+      }
+    }
+
+    if (reloadGroup)
+    {
+      this->LoadRelativeFileGroup(0, true, true);
+      this->Internals->Engine->getInteractor().triggerNotification("File Group Reloaded");
+    }
   }
 }
 
@@ -2973,6 +3783,7 @@ void F3DStarter::AddCommands()
         }
         this->Internals->FilesGroups.erase(
           this->Internals->FilesGroups.begin() + this->Internals->CurrentFilesGroupIndex);
+        this->Internals->FilesGroupsIndexOutdated = true;
         this->LoadRelativeFileGroup(0, false, true);
       }
     },
@@ -2988,6 +3799,7 @@ void F3DStarter::AddCommands()
         this->Internals->Engine->getInteractor().stopAnimation();
       }
       this->Internals->FilesGroups.clear();
+      this->Internals->FilesGroupsIndexOutdated = true;
       this->LoadFileGroup(0, false, true);
       this->ResetWindowName();
     },
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# Test the render server Unix socket by starting a server
+# and checking the socket is only accessible by the current user
+
+set -euo pipefail
+f3d_cmd=$1
+data_dir=$2
+tmp_dir=$3
+
+socket=$tmp_dir/TestServerSocket.sock
+rm -f $socket
+
+$f3d_cmd --no-config --server=$socket $data_dir/cow.vtp &
+pid=$!
+
+function cleanup()
+{
+  kill -SIGTERM $pid
+}
+trap "cleanup" EXIT
+
+for i in $(seq 1 30); do
+  [ -S $socket ] && break
+  sleep 1
+done
+
+[ -S $socket ]
+ls -l $socket | grep -q "^srw------- "
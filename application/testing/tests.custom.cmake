@@ -72,6 +72,17 @@ set_tests_properties(f3d::TestNoFileFileNameTemplate PROPERTIES ENVIRONMENT "CTE
 # Test that f3d can read DPI scaling from system, note that this test has no reference baseline.
 add_test(NAME f3d::TestSystemDPIScaling COMMAND $<TARGET_FILE:f3d> ${F3D_SOURCE_DIR}/testing/data/suzanne.stl --dpi-aware --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestSystemDPIScaling.png)
 
+# Test the render server Unix socket is only accessible by the current user
+# and that the server never replaces a file that is not a socket
+if (UNIX)
+  add_test(NAME f3d::TestServerSocket COMMAND ${CMAKE_CURRENT_SOURCE_DIR}/test_server_socket.sh $<TARGET_FILE:f3d> ${F3D_SOURCE_DIR}/testing/data ${CMAKE_BINARY_DIR}/Testing/Temporary)
+  set_tests_properties(f3d::TestServerSocket PROPERTIES TIMEOUT 60)
+
+  file(WRITE ${CMAKE_BINARY_DIR}/Testing/Temporary/TestServerNotSocket.txt "not a socket\n")
+  add_test(NAME f3d::TestServerNotSocket COMMAND $<TARGET_FILE:f3d> --no-config --server=${CMAKE_BINARY_DIR}/Testing/Temporary/TestServerNotSocket.txt ${F3D_SOURCE_DIR}/testing/data/cow.vtp)
+  set_tests_properties(f3d::TestServerNotSocket PROPERTIES PASS_REGULAR_EXPRESSION "exists and is not a socket")
+endif ()
+
 if (APPLE)
   add_test(NAME f3d::TestAppleCmdMod COMMAND $<TARGET_FILE:f3d> --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestAppleCmdMod.png --reference=${F3D_SOURCE_DIR}/testing/baselines/TestAppleCmdMod.png --resolution=400,400)
   set_tests_properties(f3d::TestAppleCmdMod PROPERTIES ENVIRONMENT "CTEST_F3D_NO_DATA_FORCE_RENDER=1")
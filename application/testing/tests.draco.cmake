@@ -3,6 +3,8 @@
 f3d_test(NAME TestDRACO DATA suzanne.drc PLUGIN draco)
 f3d_test(NAME TestDRACOColoring DATA suzanne.drc PLUGIN draco ARGS --scalar-coloring --coloring-component=0)
 f3d_test(NAME TestGLTFDracoImporter DATA Box_draco.glb PLUGIN draco ARGS --verbose)
+# Texture coordinates are unsigned bytes, normalized to (0.2, 0.8) when decoded as 8-bit values
+f3d_test(NAME TestGLTFDracoImporterUnsignedByte DATA QuadDracoUnsignedByte.gltf PLUGIN draco ARGS --force-reader=GLTFDraco --verbose NO_RENDER NO_BASELINE REGEXP "0\\.2, 0\\.2")
 f3d_test(NAME TestGLTFDracoImporterWithoutCompression DATA BoxAnimated.gltf PLUGIN draco ARGS --animation-time=2 --animation-progress --force-reader=GLTFDraco UI)
 
 f3d_test(NAME TestPipedDRACO DATA suzanne.drc PLUGIN draco ARGS PIPED_READER Draco PIPED)
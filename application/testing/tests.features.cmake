@@ -35,6 +35,8 @@ endif()
 
 # FX
 f3d_test(NAME TestSSAO DATA suzanne.ply ARGS -q)
+f3d_test(NAME TestSSAOProgressive DATA suzanne.ply ARGS -q --progressive BASELINE_PATH ${F3D_SOURCE_DIR}/testing/baselines/TestSSAO.png)
+f3d_test(NAME TestLODSmallMesh DATA dragon.vtu ARGS --lod --verbose=debug REGEXP_FAIL "levels of detail" BASELINE_PATH ${F3D_SOURCE_DIR}/testing/baselines/TestVTU.png)
 f3d_test(NAME TestDepthPeeling DATA suzanne.ply ARGS -sp --opacity=0.9 SKIP_GLES)
 f3d_test(NAME TestToneMapping DATA suzanne.ply ARGS -t)
 f3d_test(NAME TestDepthPeelingToneMapping DATA suzanne.ply ARGS --opacity=0.9 -pt SKIP_GLES)
@@ -70,7 +72,10 @@ f3d_test(NAME TestMorphEdges DATA SimpleMorph.gltf ARGS --edges --line-width=5)
 f3d_test(NAME TestAnimationUserMatrixColoring DATA InterpolationTest.glb ARGS --scalar-coloring --coloring-array=TEXCOORD_0 --animation-time=0.5)
 f3d_test(NAME TestAnimationSkinColoring DATA SimpleSkin.gltf ARGS --scalar-coloring --coloring-array=WEIGHTS_0 --animation-time=2)
 f3d_test(NAME TestAnimationMorphColoring DATA SimpleMorph.gltf ARGS --scalar-coloring --animation-time=0.5)
-f3d_test(NAME TestAnimationInputChangeColoring DATA v_rock2.mdl ARGS --scalar-coloring --animation-time=0.01 --animation-indices=1)
+# More than four morph targets are applied from texture buffers, compared with the same mesh morphed beforehand
+f3d_test(NAME TestGLTFMorphManyTargetsBaked DATA MorphManyTargetsBaked.gltf ARGS --camera-position=0,0,8 --camera-focal-point=0,0,0 NO_BASELINE)
+f3d_test(NAME TestGLTFMorphManyTargets DATA MorphManyTargets.gltf ARGS --camera-position=0,0,8 --camera-focal-point=0,0,0 DEPENDS TestGLTFMorphManyTargetsBaked BASELINE_PATH ${CMAKE_BINARY_DIR}/Testing/Temporary/TestGLTFMorphManyTargetsBaked.png SKIP_GLES)
+f3d_test(NAME TestAnimationInputChangeColoring DATA v_rock2.mdl ARGS -DQuakeMDL.interpolate_frames=0 --scalar-coloring --animation-time=0.01 --animation-indices=1)
 
 # Depth
 f3d_test(NAME TestDisplayDepth DATA dragon.vtu ARGS --display-depth)
@@ -258,17 +263,17 @@ if(VTK_VERSION VERSION_GREATER_EQUAL 9.5.20251001)
 endif()
 
 ## Animation
-f3d_test(NAME TestAnimationIndicesSingle DATA soldier_animations.mdl ARGS --animation-indices=7 --animation-time=0.5 --animation-progress UI)
+f3d_test(NAME TestAnimationIndicesSingle DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=7 --animation-time=0.5 --animation-progress UI)
 f3d_test(NAME TestAnimationIndicesMulti DATA InterpolationTest.glb ARGS --animation-indices=7,6 --animation-time=0.5 --animation-progress UI)
 f3d_test(NAME TestAnimationIndexDeprecated DATA InterpolationTest.glb ARGS --animation-index=7 --animation-time=0.5 --animation-progress UI)
 f3d_test(NAME TestMultiFileAnimationIndices DATA InterpolationTest.glb BoxAnimated.gltf ARGS --animation-indices=9 --animation-time=0.85 --animation-progress --multi-file-mode=all UI)
-f3d_test(NAME TestAnimationProgressBarWithScalarBar DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5 --animation-progress=advanced --scalar-coloring --coloring-scalar-bar UI)
-f3d_test(NAME TestAnimationProgressBarSpeedFactor DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5 --animation-progress=advanced --animation-speed-factor=1.5 RESOLUTION 400,300 UI)
+f3d_test(NAME TestAnimationProgressBarWithScalarBar DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5 --animation-progress=advanced --scalar-coloring --coloring-scalar-bar UI)
+f3d_test(NAME TestAnimationProgressBarSpeedFactor DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5 --animation-progress=advanced --animation-speed-factor=1.5 RESOLUTION 400,300 UI)
 # Needs https://gitlab.kitware.com/vtk/vtk/-/merge_requests/12688
 if(VTK_VERSION VERSION_GREATER_EQUAL 9.5.20251006)
   f3d_test(NAME TestMultiFileAnimationNoneMulti DATA bot2.wrl InterpolationTest.glb ARGS --animation-indices=6 --animation-time=0.85 --multi-file-mode=all)
 endif()
-f3d_test(NAME TestMultiFileAnimationAnySingle DATA soldier_animations.mdl InterpolationTest.glb ARGS --animation-indices=13 --animation-time=0.85 --multi-file-mode=all --opacity=0.5)
+f3d_test(NAME TestMultiFileAnimationAnySingle DATA soldier_animations.mdl InterpolationTest.glb ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=13 --animation-time=0.85 --multi-file-mode=all --opacity=0.5)
 f3d_test(NAME TestMultiFileAnimationNoAnimationSupport DATA f3d.glb world.obj ARGS --multi-file-mode=all --animation-time=2 --animation-progress UI)
 f3d_test(NAME TestAnimationAutoplay DATA InterpolationTest.glb ARGS --animation-autoplay)
 f3d_test(NAME TestAnimationAllAnimations DATA InterpolationTest.glb ARGS --animation-indices=-1 --animation-time=1 --animation-progress UI)
@@ -313,7 +318,7 @@ f3d_test(NAME TestInvalidInteractionStyle DATA suzanne.ply ARGS --interaction-st
 f3d_test(NAME TestPointSpritesImplicit DATA suzanne.ply ARGS -o --verbose REGEXP "'point-sprites' = 'sphere'" NO_BASELINE)
 f3d_test(NAME TestInvalidPointSprites DATA suzanne.ply ARGS --point-sprites=foo REGEXP "foo is an invalid point sprites type" NO_BASELINE)
 f3d_test(NAME TestAnimationUserMatrixPointSprites DATA BoxAnimated.gltf ARGS --point-sprites --point-sprites-size=50 --animation-time=2)
-f3d_test(NAME TestAnimationInputChangePointSprites DATA v_rock2.mdl ARGS --point-sprites --point-sprites-size=50 --animation-time=0.01 --animation-indices=1)
+f3d_test(NAME TestAnimationInputChangePointSprites DATA v_rock2.mdl ARGS -DQuakeMDL.interpolate_frames=0 --point-sprites --point-sprites-size=50 --animation-time=0.01 --animation-indices=1)
 
 ## Backdrop
 f3d_test(NAME TestBackdropOpacityOpaque DATA suzanne.ply ARGS -n --backdrop-opacity=1.0 UI)
@@ -326,14 +331,8 @@ if(VTK_VERSION VERSION_GREATER_EQUAL 9.5.20251001)
 endif()
 
 ## Skinning
-if(APPLE AND NOT F3D_TESTING_FORCE_RENDERING_BACKEND STREQUAL "osmesa") # MacOS driver does not support OpenGL 4.3
-  f3d_test(NAME TestSkinningManyBonesFailure DATA tube_254bones.glb ARGS --verbose REGEXP "which requires OpenGL" NO_BASELINE)
-else()
-  if(VTK_VERSION VERSION_GREATER_EQUAL 9.4.20241219) # The baseline changed with armature support
-    # Strictly speaking, this test can also fail if ran without OpenGL 4.3 support on Windows and Linux
-    # Instead of checking MacOS only, we should try to get OpenGL capabilities from CMake later instead
-    f3d_test(NAME TestSkinningManyBones DATA tube_254bones.glb SKIP_GLES)
-  endif()
+if(VTK_VERSION VERSION_GREATER_EQUAL 9.4.20241219) # The baseline changed with armature support
+  f3d_test(NAME TestSkinningManyBones DATA tube_254bones.glb SKIP_GLES)
 endif()
 
 ## Armature
@@ -498,29 +497,29 @@ f3d_test(NAME TestCommandScriptRemoveFileGroups SCRIPT DATA dragon.vtu NO_DATA_F
 f3d_test(NAME TestCommandScriptInvalidReaderOptions SCRIPT DATA dragon.vtu REGEXP "point to an inexistent option, ignoring" NO_BASELINE) # set_reader_option invalid value
 f3d_test(NAME TestCommandScriptHelp SCRIPT DATA dragon.vtu REGEX "set a libf3d option" NO_BASELINE) # help set
 f3d_test(NAME TestCommandScriptHelpInvalid SCRIPT DATA dragon.vtu REGEX "is not a recognized command" NO_BASELINE) # help invalid
-f3d_test(NAME TestCommandScriptJumpToPreviousFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToNextFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToFirstFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToLastFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToMiddleFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToPreviousKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToNextKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToFirstKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToAbsoluteKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToPreviousFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToNextFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToFirstFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToLastFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToMiddleFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToPreviousKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToNextKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToFirstKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToAbsoluteKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
 if (VTK_VERSION VERSION_GREATER_EQUAL 9.5.0 AND F3D_PLUGIN_BUILD_ASSIMP AND F3D_ASSIMP_VERSION VERSION_GREATER_EQUAL "6.0.1")
   # TODO: Update this test to NOT use assimp once generic importer supports timesteps properly (issue: https://github.com/f3d-app/f3d/issues/2733)
-  f3d_test(NAME TestCommandScriptJumpToAbsoluteKeyFrameMultipleAnimations SCRIPT DATA punch.fbx soldier_animations.mdl ARGS --load-plugins=assimp --multi-file-mode=all --animation-indices=0,2 --animation-progress UI)
+  f3d_test(NAME TestCommandScriptJumpToAbsoluteKeyFrameMultipleAnimations SCRIPT DATA punch.fbx soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --load-plugins=assimp --multi-file-mode=all --animation-indices=0,2 --animation-progress UI)
 endif()
-f3d_test(NAME TestCommandScriptJumpToClosestKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-time=0.14 --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToStartKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-time=0.4 --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToPositiveOutsideKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
-f3d_test(NAME TestCommandScriptJumpToNegativeOutsideKeyFrame SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToClosestKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-time=0.14 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToStartKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-time=0.4 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToPositiveOutsideKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
+f3d_test(NAME TestCommandScriptJumpToNegativeOutsideKeyFrame SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress UI)
 f3d_test(NAME TestCommandScriptJumpToKeyFrameNoAnimation SCRIPT DATA cow.vtp)
-f3d_test(NAME TestCommandScriptJumpToTimeAbsolutePositive SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress=advanced UI)
-f3d_test(NAME TestCommandScriptJumpToTimeRelativeForward SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.55 --animation-progress=advanced UI)
-f3d_test(NAME TestCommandScriptJumpToTimeRelativeBackward SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.55 --animation-progress=advanced UI)
-f3d_test(NAME TestCommandScriptJumpToTimeBelowMin SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress=advanced UI)
-f3d_test(NAME TestCommandScriptJumpToTimeAboveMax SCRIPT DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-progress=advanced UI)
+f3d_test(NAME TestCommandScriptJumpToTimeAbsolutePositive SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress=advanced UI)
+f3d_test(NAME TestCommandScriptJumpToTimeRelativeForward SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.55 --animation-progress=advanced UI)
+f3d_test(NAME TestCommandScriptJumpToTimeRelativeBackward SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.55 --animation-progress=advanced UI)
+f3d_test(NAME TestCommandScriptJumpToTimeBelowMin SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress=advanced UI)
+f3d_test(NAME TestCommandScriptJumpToTimeAboveMax SCRIPT DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-progress=advanced UI)
 f3d_test(NAME TestCommandScriptSetCameraBack SCRIPT DATA dragon.vtu) # set_camera back
 f3d_test(NAME TestCommandScriptSetCameraBottom SCRIPT DATA dragon.vtu) # set_camera bottom
 f3d_test(NAME TestCommandScriptSetCameraLeft SCRIPT DATA dragon.vtu) # set_camera left
@@ -579,6 +578,19 @@ f3d_test(NAME TestOutputFrameCountFrame1 DATA BoxAnimated.gltf ARGS --reference=
 f3d_test(NAME TestOutputFrameCountNoAnimation DATA cow.vtp ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/static_{frame:4}.png REGEXP "No animation available" NO_BASELINE NO_OUTPUT)
 f3d_test(NAME TestOutputFrameCountInvalidFormat DATA BoxAnimated.gltf ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/invalid_{frame:abc}.png --frame-rate=0.25 REGEXP "ignoring invalid frame format" NO_BASELINE NO_OUTPUT)
 f3d_test(NAME TestOutputFrameCountStartTime DATA BoxAnimated.gltf ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputFrameCountStartTime_{frame:4}.png --frame-rate=0.3 --animation-time=2.0 REGEXP "Saving 2 animation frame" NO_BASELINE NO_OUTPUT)
+f3d_test(NAME TestOutputViews DATA cow.vtp ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputViews_{view:2}.png --output-views=4 REGEXP "Saved 4 view" NO_BASELINE NO_OUTPUT)
+f3d_test(NAME TestOutputViewsView0 DATA cow.vtp ARGS --reference=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputViews_00.png DEPENDS TestOutputViews NO_BASELINE)
+f3d_test(NAME TestOutputViewsView1 DATA cow.vtp ARGS --reference=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputViews_01.png --camera-azimuth-angle=90 DEPENDS TestOutputViews NO_BASELINE)
+f3d_test(NAME TestOutputFrameViews DATA BoxAnimated.gltf ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputFrameViews_{frame}_{view}.png --frame-rate=0.25 --output-views=2 REGEXP "Saved 4 image" NO_BASELINE NO_OUTPUT)
+f3d_test(NAME TestOutputFrameViewsFrame1View1 DATA BoxAnimated.gltf ARGS --reference=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputFrameViews_1_1.png --animation-time=3.70833 --camera-azimuth-angle=180 DEPENDS TestOutputFrameViews NO_BASELINE)
+f3d_test(NAME TestOutputViewsInvalidCount DATA cow.vtp ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/invalid_{view}.png --output-views=0 REGEXP "Invalid number of output views" NO_BASELINE NO_OUTPUT)
+f3d_test(NAME TestOutputAllGroups DATA cow.vtp dragon.vtu ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputAllGroups_{model}.png --output-all-groups REGEXP "Saved 2 image\\(s\\) from 2 file groups" NO_BASELINE NO_OUTPUT)
+f3d_test(NAME TestOutputAllGroupsCow DATA cow.vtp ARGS --reference=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputAllGroups_cow.png DEPENDS TestOutputAllGroups NO_BASELINE)
+f3d_test(NAME TestOutputAllGroupsDragon DATA dragon.vtu ARGS --reference=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputAllGroups_dragon.png DEPENDS TestOutputAllGroups NO_BASELINE)
+f3d_test(NAME TestOutputAllGroupsNoModel DATA cow.vtp dragon.vtu ARGS --output=${CMAKE_BINARY_DIR}/Testing/Temporary/TestOutputAllGroupsNoModel.png --output-all-groups REGEXP "does not use the {model} or {n} variables" NO_BASELINE NO_OUTPUT)
+# Render server reading requests from the standard input
+f3d_test(NAME TestServerStdin PIPED_ARG --server= DATA ../scripts/TestServer.txt NO_BASELINE NO_OUTPUT REGEXP "image [0-9]+" PIPED)
+f3d_test(NAME TestServerStdinInvalid PIPED_ARG --server= DATA ../scripts/TestServer.txt NO_BASELINE NO_OUTPUT REGEXP "error invalid command: invalid_command" PIPED)
 f3d_test(NAME TestCommandScriptScreenshotFrame SCRIPT DATA cow.vtp ARGS --screenshot-filename=${CMAKE_BINARY_DIR}/Testing/Temporary/screenshot_{frame}.png REGEXP "{frame} variable can only be used when outputting animation frames" NO_BASELINE)
 
 # Basic record and play test
@@ -795,6 +807,10 @@ if(VTK_VERSION VERSION_GREATER_EQUAL 9.5.20251001)
 endif()
 f3d_test(NAME TestMatchSecondConfigGlobOptionBlock DATA suzanne.stl CONFIG ${CMAKE_BINARY_DIR}/glob.json)
 
+# Test the extension globs matched without a regex, a comma outside of braces is a literal character
+f3d_test(NAME TestConfigGlobExtension DATA suzanne_upper.STL ARGS --verbose=debug CONFIG ${F3D_SOURCE_DIR}/testing/configs/glob_extensions.json REGEXP "'ui.axis' = 'true' from .*glob_extensions.json:`\\*\\.stl`" NO_BASELINE)
+f3d_test(NAME TestConfigGlobExtensionsGroup DATA suzanne.ply ARGS --verbose=debug CONFIG ${F3D_SOURCE_DIR}/testing/configs/glob_extensions.json REGEXP "'ui.fps' = 'true' from .*glob_extensions.json:`\\*\\.{obj,PLY}`" REGEXP_FAIL "'ui.filename' = 'true'" NO_BASELINE)
+
 # Test exact matching
 cmake_path(SET FIRST_EXACT_PATH "${F3D_SOURCE_DIR}/testing/data/suzanne.obj")
 cmake_path(NATIVE_PATH FIRST_EXACT_PATH NATIVE_FIRST_EXACT_PATH)
@@ -864,6 +880,7 @@ if(NOT WIN32)
   f3d_test(NAME TestReferenceTooLong DATA suzanne.ply ARGS --output=file.png --reference=${_f3d_test_invalid_folder}/file.ext REGEXP "File name too long" NO_BASELINE NO_OUTPUT)
   f3d_test(NAME TestOutputTooLong DATA suzanne.ply ARGS --output=${_f3d_test_invalid_folder}/file.ext REGEXP "File name too long" NO_BASELINE NO_OUTPUT)
   f3d_test(NAME TestOutputFrameCountTooLong DATA BoxAnimated.gltf ARGS --output=${_f3d_test_invalid_folder}/frame_{frame}.png --frame-rate=0.25 REGEXP "Could not write output" NO_BASELINE NO_OUTPUT)
+  f3d_test(NAME TestOutputAllGroupsTooLong DATA cow.vtp dragon.vtu ARGS --output=${_f3d_test_invalid_folder}/{model}.png --output-all-groups REGEXP "Could not write output" REGEXP_FAIL "Saved [0-9]+ image" NO_BASELINE NO_OUTPUT)
   f3d_test(NAME TestOutputFrameCountNoAnimationTooLong DATA cow.vtp ARGS --output=${_f3d_test_invalid_folder}/frame_{frame}.png REGEXP "Could not write output" NO_BASELINE NO_OUTPUT)
   f3d_test(NAME TestOutputWithReferenceTooLong DATA suzanne.ply ARGS --reference=file.png --output=${_f3d_test_invalid_folder}/file.ext REGEXP "File name too long" NO_BASELINE NO_OUTPUT)
   f3d_test(NAME TestOutputWithExistingReferenceTooLong DATA suzanne.ply ARGS --reference=${F3D_SOURCE_DIR}/testing/data/world.png --output=${_f3d_test_invalid_folder}/file.ext REGEXP "File name too long" NO_BASELINE NO_OUTPUT)
@@ -7,7 +7,12 @@ f3d_test(NAME TestExodusExo DATA box.exo PLUGIN hdf ARGS NO_RENDER NO_BASELINE R
 f3d_test(NAME TestExodusG DATA box.g PLUGIN hdf ARGS NO_RENDER NO_BASELINE REGEXP "Number of points: 24")
 f3d_test(NAME TestExodusE DATA single_timestep.e PLUGIN hdf ARGS NO_RENDER NO_BASELINE REGEXP "Number of points: 1331")
 f3d_test(NAME TestExodusConfig DATA disk_out_ref.ex2 CONFIG ${F3D_SOURCE_DIR}/testing/configs/exodus.json ARGS -s --camera-position=-11,-2,-49 LABELS "plugin;hdf")
+f3d_test(NAME TestExodusColoringArrayOnly DATA disk_out_ref.ex2 PLUGIN hdf ARGS -s --coloring-array=Pres --verbose NO_RENDER NO_BASELINE REGEXP "Coloring using point array named Pres" REGEXP_FAIL "AsH3")
+f3d_test(NAME TestCommandScriptExodusCycleColoringArray SCRIPT DATA disk_out_ref.ex2 PLUGIN hdf ARGS -s --coloring-array=Pres NO_BASELINE REGEXP "AsH3") # cycle_coloring array, print_mesh_info
+f3d_test(NAME TestCommandScriptExodusSetColoringArray SCRIPT DATA disk_out_ref.ex2 PLUGIN hdf ARGS -s --coloring-array=Pres --verbose=debug NO_BASELINE REGEXP "Coloring using point array named AsH3") # set model.scivis.array_name AsH3
+f3d_test(NAME TestExodusArraysInvalid DATA box.exo PLUGIN hdf ARGS -DExodusII.arrays=invalid NO_RENDER NO_BASELINE REGEXP "ExodusII.arrays: invalid is not a nodal or element variable")
 f3d_test(NAME TestNetCDF DATA temperature_grid.nc PLUGIN hdf ARGS -s)
+f3d_test(NAME TestNetCDFArraysInvalid DATA temperature_grid.nc PLUGIN hdf ARGS -DNetCDF.arrays=invalid NO_RENDER NO_BASELINE REGEXP "NetCDF.arrays: invalid is not a variable")
 f3d_test(NAME TestVTKHDF DATA blob.vtkhdf PLUGIN hdf ARGS -s)
 f3d_test(NAME TestAMRDataSet DATA amr.vtkhdf PLUGIN hdf ARGS -s)
 f3d_test(NAME TestVTKHDFPartitionedDataSetCollection DATA pdc_sphere_cone.vtkhdf PLUGIN hdf ARGS -s)
@@ -37,18 +37,22 @@ f3d_test(NAME TestGLTFImporterUnlit DATA UnlitTest.glb)
 f3d_test(NAME TestGLTFMorph DATA SimpleMorph.gltf)
 f3d_test(NAME TestGLTFURI DATA Lantern/Lantern.gltf)
 f3d_test(NAME TestQuakeMDL DATA zombie.mdl)
-f3d_test(NAME TestQuakeMDLAnimationSimpleFrame DATA zombie.mdl ARGS --animation-time=0.5)
-f3d_test(NAME TestQuakeMDLAnimationBetween DATA zombie.mdl ARGS --animation-time=1.42)
-f3d_test(NAME TestQuakeMDLAnimationMulti DATA soldier_animations.mdl ARGS --animation-indices=2 --animation-time=0.5)
-f3d_test(NAME TestQuakeMDLAnimationGroupFrame DATA flame_mixed.mdl ARGS --animation-indices=1 --animation-time=0.5)
-f3d_test(NAME TestQuakeMDLAnimationLastFrame DATA flame_mixed.mdl ARGS --camera-position=90,0,0 --animation-time=0.65)
-f3d_test(NAME TestQuakeMDLDisableAnimation DATA zombie.mdl soldier_animations.mdl ARGS --multi-file-mode=all --animation-time=0.5)
+f3d_test(NAME TestQuakeMDLAnimationSimpleFrame DATA zombie.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-time=0.5)
+f3d_test(NAME TestQuakeMDLAnimationBetween DATA zombie.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-time=1.42)
+f3d_test(NAME TestQuakeMDLAnimationMulti DATA soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=2 --animation-time=0.5)
+f3d_test(NAME TestQuakeMDLAnimationGroupFrame DATA flame_mixed.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=1 --animation-time=0.5)
+f3d_test(NAME TestQuakeMDLAnimationLastFrame DATA flame_mixed.mdl ARGS -DQuakeMDL.interpolate_frames=0 --camera-position=90,0,0 --animation-time=0.65)
+f3d_test(NAME TestQuakeMDLDisableAnimation DATA zombie.mdl soldier_animations.mdl ARGS -DQuakeMDL.interpolate_frames=0 --multi-file-mode=all --animation-time=0.5)
 f3d_test(NAME TestQuakeMDLSkinIndex DATA armor.mdl ARGS -DQuakeMDL.skin_index=2)
 f3d_test(NAME TestQuakeMDLSkinIndexNegative DATA armor.mdl ARGS -DQuakeMDL.skin_index=-1)
 f3d_test(NAME TestQuakeMDLSkinIndexNonInteger DATA armor.mdl ARGS -DQuakeMDL.skin_index=1.5)
 f3d_test(NAME TestQuakeMDLSkinIndexOutOfBounds DATA armor.mdl ARGS -DQuakeMDL.skin_index=4)
 f3d_test(NAME TestQuakeMDLSkinIndexOverflow DATA armor.mdl ARGS -DQuakeMDL.skin_index=9223372036854775808)
-f3d_test(NAME TestQuakeMDLGroupSkin DATA groupskin.mdl ARGS --animation-indices=1 --animation-time=0.3)
+f3d_test(NAME TestQuakeMDLGroupSkin DATA groupskin.mdl ARGS -DQuakeMDL.interpolate_frames=0 --animation-indices=1 --animation-time=0.3)
+# Frames are interpolated on the GPU by default, compared with the frame interpolated beforehand
+f3d_test(NAME TestQuakeMDLInterpolatedFrameBaked DATA PyramidFramesBaked.mdl ARGS --camera-position=20,-30,20 --camera-focal-point=0,0,0 NO_BASELINE)
+f3d_test(NAME TestQuakeMDLInterpolatedFrame DATA PyramidFrames.mdl ARGS --animation-time=0.05 --camera-position=20,-30,20 --camera-focal-point=0,0,0 DEPENDS TestQuakeMDLInterpolatedFrameBaked BASELINE_PATH ${CMAKE_BINARY_DIR}/Testing/Temporary/TestQuakeMDLInterpolatedFrameBaked.png)
+f3d_test(NAME TestQuakeMDLKeyframesNotColoring DATA zombie.mdl ARGS -s --coloring-array=target0_position --verbose REGEXP "Unknown scalar array: \"target0_position\"" NO_BASELINE)
 f3d_test(NAME TestVerboseQuakeMDLAnimationNoNamingScheme ARGS --verbose DATA v_rock2.mdl REGEXP "0: flame" NO_BASELINE)
 f3d_test(NAME TestVerboseQuakeMDLGroupSkin ARGS --verbose DATA groupskin.mdl REGEXP "0: group_skin" NO_BASELINE)
 f3d_test(NAME TestVerboseQuakeMDLInvalid ARGS --verbose --force-reader=QuakeMDL DATA invalid_version.mdl REGEXP "Unsupported MDL version" NO_BASELINE)
@@ -16,6 +16,8 @@ f3d_test(NAME TestVDBDefinesDownsamplingFactor DATA icosahedron.vdb PLUGIN vdb A
 f3d_test(NAME TestVDBDefinesInexistent DATA icosahedron.vdb PLUGIN vdb ARGS -Dvdb.downsampling_factor=0.2 REGEXP "did you mean 'VDB.downsampling_factor'" NO_BASELINE)
 f3d_test(NAME TestVDBDefinesDownsamplingFactorParseError DATA icosahedron.vdb PLUGIN vdb ARGS -DVDB.downsampling_factor=abcde --verbose REGEXP "Could not parse VDB.downsampling_factor" NO_BASELINE)
 f3d_test(NAME TestVDBDefinesDownsamplingFactorOutOfRangeError DATA icosahedron.vdb PLUGIN vdb ARGS -DVDB.downsampling_factor=${_outOfRangeDoubleStr} --verbose REGEXP "VDB.downsampling_factor out of range" NO_BASELINE)
+f3d_test(NAME TestVDBDefinesMaxVoxels DATA icosahedron.vdb PLUGIN vdb ARGS -DVDB.max_voxels=100 --verbose REGEXP "Number of points: [0-9][0-9]?[0-9]?\n" NO_RENDER)
+f3d_test(NAME TestVDBDefinesMaxVoxelsParseError DATA icosahedron.vdb PLUGIN vdb ARGS -DVDB.max_voxels=abcde --verbose REGEXP "Could not parse VDB.max_voxels" NO_BASELINE)
 f3d_test(NAME TestVDBCommandScriptReaderOptions SCRIPT DATA icosahedron.vdb PLUGIN vdb ARGS --volume --volume-inverse) # set_reader_option VDB.downsampling_factor 0.2; reload_current_file_group
 f3d_test(NAME TestVDBPoints DATA sphere_points.vdb PLUGIN vdb ARGS -o)
 
@@ -1,5 +1,6 @@
 #include "camera_c_api.h"
 #include "camera.h"
+#include "camera_c_api_utils.h"
 
 //----------------------------------------------------------------------------
 void f3d_camera_set_position(f3d_camera_t* camera, const f3d_point3_t pos)
@@ -121,12 +122,7 @@ void f3d_camera_set_state(f3d_camera_t* camera, const f3d_camera_state_t* state)
   }
 
   f3d::camera* cpp_camera = reinterpret_cast<f3d::camera*>(camera);
-  f3d::camera_state_t cpp_state;
-  cpp_state.position = { state->position[0], state->position[1], state->position[2] };
-  cpp_state.focalPoint = { state->focal_point[0], state->focal_point[1], state->focal_point[2] };
-  cpp_state.viewUp = { state->view_up[0], state->view_up[1], state->view_up[2] };
-  cpp_state.viewAngle = state->view_angle;
-  cpp_camera->setState(cpp_state);
+  cpp_camera->setState(f3d::c_api::ToCameraState(*state));
 }
 
 //----------------------------------------------------------------------------
@@ -140,16 +136,7 @@ void f3d_camera_get_state(const f3d_camera_t* camera, f3d_camera_state_t* state)
   const f3d::camera* cpp_camera = reinterpret_cast<const f3d::camera*>(camera);
   f3d::camera_state_t cpp_state;
   cpp_camera->getState(cpp_state);
-  state->position[0] = cpp_state.position[0];
-  state->position[1] = cpp_state.position[1];
-  state->position[2] = cpp_state.position[2];
-  state->focal_point[0] = cpp_state.focalPoint[0];
-  state->focal_point[1] = cpp_state.focalPoint[1];
-  state->focal_point[2] = cpp_state.focalPoint[2];
-  state->view_up[0] = cpp_state.viewUp[0];
-  state->view_up[1] = cpp_state.viewUp[1];
-  state->view_up[2] = cpp_state.viewUp[2];
-  state->view_angle = cpp_state.viewAngle;
+  f3d::c_api::FromCameraState(cpp_state, *state);
 }
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,37 @@
+#ifndef F3D_CAMERA_C_API_UTILS_H
+#define F3D_CAMERA_C_API_UTILS_H
+
+#include "camera.h"
+#include "camera_c_api.h"
+
+/**
+ * Conversion helpers between the C and C++ camera states, shared by the C API implementations.
+ * This header is private and not installed.
+ */
+namespace f3d::c_api
+{
+//----------------------------------------------------------------------------
+inline camera_state_t ToCameraState(const f3d_camera_state_t& state)
+{
+  camera_state_t cpp_state;
+  cpp_state.position = { state.position[0], state.position[1], state.position[2] };
+  cpp_state.focalPoint = { state.focal_point[0], state.focal_point[1], state.focal_point[2] };
+  cpp_state.viewUp = { state.view_up[0], state.view_up[1], state.view_up[2] };
+  cpp_state.viewAngle = state.view_angle;
+  return cpp_state;
+}
+
+//----------------------------------------------------------------------------
+inline void FromCameraState(const camera_state_t& cpp_state, f3d_camera_state_t& state)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    state.position[i] = cpp_state.position[i];
+    state.focal_point[i] = cpp_state.focalPoint[i];
+    state.view_up[i] = cpp_state.viewUp[i];
+  }
+  state.view_angle = cpp_state.viewAngle;
+}
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include <window_c_api.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 
 int test_window()
 {
@@ -50,6 +51,55 @@ int test_window()
   int width = f3d_window_get_width(window);
   int height = f3d_window_get_height(window);
 
+  size_t stride = (size_t)width * 4 + 16;
+  size_t view_size = stride * (size_t)height;
+  unsigned char* buffer = malloc(2 * view_size);
+  if (!buffer)
+  {
+    puts("[ERROR] Failed to allocate buffer");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  if (!f3d_window_render_to_buffer(window, buffer, view_size, stride, 1))
+  {
+    puts("[ERROR] Failed to render to buffer");
+    free(buffer);
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  if (f3d_window_render_to_buffer(window, buffer, view_size - 1, stride, 1))
+  {
+    puts("[ERROR] Render to a too small buffer should fail");
+    free(buffer);
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  f3d_camera_state_t states[2];
+  f3d_camera_get_state(camera, &states[0]);
+  states[1] = states[0];
+  states[1].position[0] += 1.0;
+  buffer[0] = 0x7f;
+  if (f3d_window_render_views_to_buffer(window, states, 2, buffer, 2 * view_size - 1, stride, 1) ||
+    buffer[0] != 0x7f)
+  {
+    puts("[ERROR] Render views to a too small buffer should fail without writing");
+    free(buffer);
+    f3d_engine_delete(engine);
+    return 1;
+  }
+
+  if (!f3d_window_render_views_to_buffer(window, states, 2, buffer, 2 * view_size, stride, 1))
+  {
+    puts("[ERROR] Failed to render views to buffer");
+    free(buffer);
+    f3d_engine_delete(engine);
+    return 1;
+  }
+  free(buffer);
+
   int sizeWidth = 0;
   int sizeHeight = 0;
   f3d_window_get_size(window, &sizeWidth, &sizeHeight);
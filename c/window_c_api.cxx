@@ -1,7 +1,10 @@
 #include "window_c_api.h"
+#include "camera_c_api_utils.h"
 #include "image.h"
 #include "window.h"
 
+#include <vector>
+
 //----------------------------------------------------------------------------
 f3d_window_type_t f3d_window_get_type(f3d_window_t* window)
 {
@@ -67,6 +70,42 @@ f3d_image_t* f3d_window_render_to_image(f3d_window_t* window, int no_background)
   return reinterpret_cast<f3d_image_t*>(heap_img);
 }
 
+//----------------------------------------------------------------------------
+int f3d_window_render_to_buffer(f3d_window_t* window, unsigned char* buffer, size_t buffer_size,
+  size_t stride, int no_background)
+{
+  if (!window || !buffer)
+  {
+    return 0;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  return cpp_window->renderToBuffer(buffer, buffer_size, stride, no_background != 0) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+int f3d_window_render_views_to_buffer(f3d_window_t* window, const f3d_camera_state_t* states,
+  size_t count, unsigned char* buffer, size_t buffer_size, size_t stride, int no_background)
+{
+  if (!window || !states || !buffer)
+  {
+    return 0;
+  }
+
+  std::vector<f3d::camera_state_t> cpp_states;
+  cpp_states.reserve(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    cpp_states.emplace_back(f3d::c_api::ToCameraState(states[i]));
+  }
+
+  // The views are read back directly into the buffer and the camera state is restored
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  const bool rendered = cpp_window->renderViewsToBuffer(
+    cpp_states, buffer, buffer_size, stride, no_background != 0);
+  return rendered ? 1 : 0;
+}
+
 //----------------------------------------------------------------------------
 void f3d_window_set_size(f3d_window_t* window, int width, int height)
 {
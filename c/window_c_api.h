@@ -79,6 +79,45 @@ extern "C"
    */
   F3D_EXPORT f3d_image_t* f3d_window_render_to_image(f3d_window_t* window, int no_background);
 
+  /**
+   * @brief Perform a render of the window to the screen and copy the result into a caller
+   * provided buffer.
+   *
+   * Pixels are written with BYTE channels and 3 or 4 components (RGB or RGBA), bottom row first.
+   * Set no_background to non-zero to have a transparent background and 4 components.
+   * No image is allocated, which makes this suitable for repeated renders.
+   *
+   * @param window Window handle.
+   * @param buffer Caller owned buffer receiving the pixels.
+   * @param buffer_size Size of the buffer in bytes, must be at least stride * height.
+   * @param stride Number of bytes between the start of two rows, 0 for tightly packed rows.
+   * @param no_background If non-zero, renders with a transparent background.
+   * @return 1 on success, 0 on failure.
+   */
+  F3D_EXPORT int f3d_window_render_to_buffer(f3d_window_t* window, unsigned char* buffer,
+    size_t buffer_size, size_t stride, int no_background);
+
+  /**
+   * @brief Render multiple camera states one after the other into a caller provided buffer.
+   *
+   * Each view is written as with f3d_window_render_to_buffer, view i starting at offset
+   * i * stride * height in the buffer. The views are rendered with
+   * f3d::window::renderViewsToBuffer, so they are read back directly into the buffer,
+   * the camera state is restored afterwards and nothing is written if the buffer is too small.
+   *
+   * @param window Window handle.
+   * @param states Array of camera states to render.
+   * @param count Number of camera states.
+   * @param buffer Caller owned buffer receiving the pixels of all the views.
+   * @param buffer_size Size of the buffer in bytes, must be at least count * stride * height.
+   * @param stride Number of bytes between the start of two rows, 0 for tightly packed rows.
+   * @param no_background If non-zero, renders with a transparent background.
+   * @return 1 on success, 0 on failure.
+   */
+  F3D_EXPORT int f3d_window_render_views_to_buffer(f3d_window_t* window,
+    const f3d_camera_state_t* states, size_t count, unsigned char* buffer, size_t buffer_size,
+    size_t stride, int no_background);
+
   /**
    * @brief Set the size of the window.
    *
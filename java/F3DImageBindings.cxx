@@ -4,6 +4,8 @@
 
 #include <image.h>
 
+#include <cstring>
+
 extern "C"
 {
   JNIEXPORT jobject JAVA_BIND(Image, getSupportedFormats)(JNIEnv* env, jclass)
@@ -118,7 +120,33 @@ extern "C"
     jbyte* bufferData = env->GetByteArrayElements(buffer, nullptr);
     img->setContent(bufferData);
 
-    env->ReleaseByteArrayElements(buffer, bufferData, 0);
+    // The buffer is only read, JNI_ABORT avoids copying it back if the JVM provided a copy
+    env->ReleaseByteArrayElements(buffer, bufferData, JNI_ABORT);
+    return self;
+  }
+
+  JNIEXPORT jobject JAVA_BIND(Image, setDirectContent)(
+    JNIEnv* env, jobject self, jobject buffer, jint offset)
+  {
+    jclass cls = env->GetObjectClass(self);
+    jfieldID fid = env->GetFieldID(cls, "mNativeAddress", "J");
+    jlong ptr = env->GetLongField(self, fid);
+    f3d::image* img = reinterpret_cast<f3d::image*>(ptr);
+
+    size_t size = static_cast<size_t>(img->getWidth()) * img->getHeight() *
+      img->getChannelCount() * img->getChannelTypeSize();
+
+    // Already checked on the Java side, but never read out of the buffer
+    char* bufferData = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+    if (!bufferData || offset < 0 ||
+      static_cast<size_t>(env->GetDirectBufferCapacity(buffer)) < offset + size)
+    {
+      F3DThrowJavaException(env, "java/lang/IllegalArgumentException",
+        "The provided ByteBuffer is not direct or is too small");
+      return self;
+    }
+
+    img->setContent(bufferData + offset);
     return self;
   }
 
@@ -139,6 +167,45 @@ extern "C"
     return result;
   }
 
+  JNIEXPORT jobject JAVA_BIND(Image, getContentBuffer)(JNIEnv* env, jobject self)
+  {
+    jclass cls = env->GetObjectClass(self);
+    jfieldID fid = env->GetFieldID(cls, "mNativeAddress", "J");
+    jlong ptr = env->GetLongField(self, fid);
+    f3d::image* img = reinterpret_cast<f3d::image*>(ptr);
+
+    jlong size = static_cast<jlong>(img->getWidth()) * img->getHeight() * img->getChannelCount() *
+      img->getChannelTypeSize();
+
+    // No copy, the returned direct buffer points to the image memory
+    return env->NewDirectByteBuffer(img->getContent(), size);
+  }
+
+  JNIEXPORT jobject JAVA_BIND(Image, copyDirectContent)(
+    JNIEnv* env, jobject self, jobject buffer, jint offset)
+  {
+    jclass cls = env->GetObjectClass(self);
+    jfieldID fid = env->GetFieldID(cls, "mNativeAddress", "J");
+    jlong ptr = env->GetLongField(self, fid);
+    f3d::image* img = reinterpret_cast<f3d::image*>(ptr);
+
+    size_t size = static_cast<size_t>(img->getWidth()) * img->getHeight() *
+      img->getChannelCount() * img->getChannelTypeSize();
+
+    // Already checked on the Java side, but never write out of the buffer
+    char* bufferData = static_cast<char*>(env->GetDirectBufferAddress(buffer));
+    if (!bufferData || offset < 0 ||
+      static_cast<size_t>(env->GetDirectBufferCapacity(buffer)) < offset + size)
+    {
+      F3DThrowJavaException(env, "java/lang/IllegalArgumentException",
+        "The provided ByteBuffer is not direct or is too small");
+      return self;
+    }
+
+    std::memcpy(bufferData + offset, img->getContent(), size);
+    return self;
+  }
+
   JNIEXPORT jdoubleArray JAVA_BIND(Image, getNormalizedPixel)(
     JNIEnv* env, jobject self, jint x, jint y)
   {
@@ -50,44 +50,44 @@ static f3d::mesh_t JavaMeshToCppMesh(JNIEnv* env, jobject jmesh)
   jintArray faceSidesArray = static_cast<jintArray>(env->GetObjectField(jmesh, faceSidesField));
   jintArray faceIndicesArray = static_cast<jintArray>(env->GetObjectField(jmesh, faceIndicesField));
 
+  // Arrays are copied straight into the mesh vectors, without pinning or intermediate copies
+
   if (pointsArray)
   {
     jsize pointsLen = env->GetArrayLength(pointsArray);
-    float* pointsData = env->GetFloatArrayElements(pointsArray, nullptr);
-    cppMesh.points.assign(pointsData, pointsData + pointsLen);
-    env->ReleaseFloatArrayElements(pointsArray, pointsData, 0);
+    cppMesh.points.resize(pointsLen);
+    env->GetFloatArrayRegion(pointsArray, 0, pointsLen, cppMesh.points.data());
   }
 
   if (normalsArray)
   {
     jsize normalsLen = env->GetArrayLength(normalsArray);
-    float* normalsData = env->GetFloatArrayElements(normalsArray, nullptr);
-    cppMesh.normals.assign(normalsData, normalsData + normalsLen);
-    env->ReleaseFloatArrayElements(normalsArray, normalsData, 0);
+    cppMesh.normals.resize(normalsLen);
+    env->GetFloatArrayRegion(normalsArray, 0, normalsLen, cppMesh.normals.data());
   }
 
   if (textureCoordinatesArray)
   {
     jsize texCoordsLen = env->GetArrayLength(textureCoordinatesArray);
-    float* texCoordsData = env->GetFloatArrayElements(textureCoordinatesArray, nullptr);
-    cppMesh.texture_coordinates.assign(texCoordsData, texCoordsData + texCoordsLen);
-    env->ReleaseFloatArrayElements(textureCoordinatesArray, texCoordsData, 0);
+    cppMesh.texture_coordinates.resize(texCoordsLen);
+    env->GetFloatArrayRegion(
+      textureCoordinatesArray, 0, texCoordsLen, cppMesh.texture_coordinates.data());
   }
 
   if (faceSidesArray)
   {
     jsize faceSidesLen = env->GetArrayLength(faceSidesArray);
-    int* faceSidesData = env->GetIntArrayElements(faceSidesArray, nullptr);
-    cppMesh.face_sides.assign(faceSidesData, faceSidesData + faceSidesLen);
-    env->ReleaseIntArrayElements(faceSidesArray, faceSidesData, 0);
+    cppMesh.face_sides.resize(faceSidesLen);
+    env->GetIntArrayRegion(
+      faceSidesArray, 0, faceSidesLen, reinterpret_cast<jint*>(cppMesh.face_sides.data()));
   }
 
   if (faceIndicesArray)
   {
     jsize faceIndicesLen = env->GetArrayLength(faceIndicesArray);
-    int* faceIndicesData = env->GetIntArrayElements(faceIndicesArray, nullptr);
-    cppMesh.face_indices.assign(faceIndicesData, faceIndicesData + faceIndicesLen);
-    env->ReleaseIntArrayElements(faceIndicesArray, faceIndicesData, 0);
+    cppMesh.face_indices.resize(faceIndicesLen);
+    env->GetIntArrayRegion(
+      faceIndicesArray, 0, faceIndicesLen, reinterpret_cast<jint*>(cppMesh.face_indices.data()));
   }
 
   return cppMesh;
@@ -205,9 +205,19 @@ extern "C"
 
   JNIEXPORT jobject JAVA_BIND(Scene, addBuffer)(JNIEnv* env, jobject self, jbyteArray buffer)
   {
+    if (!buffer)
+    {
+      return self;
+    }
+
     jsize bufferLen = env->GetArrayLength(buffer);
+    if (bufferLen <= 0)
+    {
+      return self;
+    }
+
     jbyte* bufferData = env->GetByteArrayElements(buffer, nullptr);
-    if (!bufferData || bufferLen <= 0)
+    if (!bufferData)
     {
       return self;
     }
@@ -221,7 +231,44 @@ extern "C"
     {
       F3DThrowJavaException(env, "app/f3d/F3D/Scene$LoadFailureException", e.what());
     }
-    env->ReleaseByteArrayElements(buffer, bufferData, 0);
+
+    // The buffer is only read, JNI_ABORT avoids copying it back if the JVM provided a copy
+    env->ReleaseByteArrayElements(buffer, bufferData, JNI_ABORT);
+    return self;
+  }
+
+  JNIEXPORT jobject JAVA_BIND(Scene, addDirectBuffer)(JNIEnv* env, jobject self, jobject buffer)
+  {
+    if (!buffer)
+    {
+      return self;
+    }
+
+    std::byte* bufferData = static_cast<std::byte*>(env->GetDirectBufferAddress(buffer));
+    if (!bufferData)
+    {
+      F3DThrowJavaException(
+        env, "java/lang/IllegalArgumentException", "The provided ByteBuffer is not direct");
+      return self;
+    }
+
+    // Only the remaining bytes, between position and limit, are loaded
+    jclass bufferClass = env->FindClass("java/nio/Buffer");
+    jint position = env->CallIntMethod(buffer, env->GetMethodID(bufferClass, "position", "()I"));
+    jint remaining = env->CallIntMethod(buffer, env->GetMethodID(bufferClass, "remaining", "()I"));
+    if (remaining <= 0)
+    {
+      return self;
+    }
+
+    try
+    {
+      GetEngine(env, self)->getScene().add(bufferData + position, static_cast<size_t>(remaining));
+    }
+    catch (const f3d::scene::load_failure_exception& e)
+    {
+      F3DThrowJavaException(env, "app/f3d/F3D/Scene$LoadFailureException", e.what());
+    }
     return self;
   }
 
@@ -1,5 +1,6 @@
 package app.f3d.F3D;
 
+import java.nio.ByteBuffer;
 import java.util.List;
 
 public class Image {
@@ -140,6 +141,68 @@ public class Image {
      */
     public native byte[] getContent();
 
+    /**
+     * Set image buffer data from a buffer, without any intermediate copy if the buffer is direct.
+     * Data is read from the position of the buffer, which must have at least width * height *
+     * channelCount * channelTypeSize bytes remaining. The position of the buffer is not modified.
+     *
+     * @param buffer byte buffer containing image data
+     * @return this image for method chaining
+     * @throws IllegalArgumentException if the buffer has not enough bytes remaining
+     */
+    public Image setContent(ByteBuffer buffer) {
+        long size = this.getContentSize();
+        if (buffer.remaining() < size) {
+            throw new IllegalArgumentException("The provided ByteBuffer has " + buffer.remaining()
+                    + " bytes remaining but the image requires " + size + " bytes");
+        }
+        if (!buffer.isDirect()) {
+            byte[] array = new byte[(int) size];
+            buffer.duplicate().get(array);
+            return this.setContent(array);
+        }
+        return this.setDirectContent(buffer, buffer.position());
+    }
+
+    private native Image setDirectContent(ByteBuffer buffer, int offset);
+
+    /**
+     * Get image buffer data as a direct buffer pointing to the image memory, without any copy.
+     * The returned buffer is only valid as long as this image is alive and must not be used
+     * after calling `delete()`.
+     *
+     * @return direct byte buffer on image data
+     */
+    public native ByteBuffer getContentBuffer();
+
+    /**
+     * Copy image buffer data into a caller provided direct buffer, without allocating.
+     * Data is written at the position of the buffer, which must be direct and have at least
+     * width * height * channelCount * channelTypeSize bytes remaining. The position of the buffer
+     * is not modified.
+     *
+     * @param buffer direct byte buffer to copy image data into
+     * @return this image for method chaining
+     * @throws IllegalArgumentException if the buffer is not direct or has not enough bytes
+     *                                  remaining
+     */
+    public Image copyContent(ByteBuffer buffer) {
+        long size = this.getContentSize();
+        if (!buffer.isDirect() || buffer.remaining() < size) {
+            throw new IllegalArgumentException(
+                    "The provided ByteBuffer is not direct or has less than " + size
+                            + " bytes remaining");
+        }
+        return this.copyDirectContent(buffer, buffer.position());
+    }
+
+    private native Image copyDirectContent(ByteBuffer buffer, int offset);
+
+    private long getContentSize() {
+        return (long) this.getWidth() * this.getHeight() * this.getChannelCount()
+                * this.getChannelTypeSize();
+    }
+
     /**
      * Compare current image to a reference.
      *
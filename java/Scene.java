@@ -1,5 +1,6 @@
 package app.f3d.F3D;
 
+import java.nio.ByteBuffer;
 import java.util.List;
 
 public class Scene {
@@ -106,6 +107,26 @@ public class Scene {
         return this.addBuffer(buffer);
     }
 
+    private native Scene addDirectBuffer(ByteBuffer buffer);
+
+    /**
+     * Add and load a buffer containing a file into the scene.
+     * Only the remaining bytes of the buffer, between its position and its limit, are loaded.
+     * Direct buffers are read in place without being copied, which is recommended for large files.
+     *
+     * @param buffer Memory buffer to load
+     * @return this scene for method chaining
+     */
+    public Scene add(ByteBuffer buffer) {
+        if (buffer.isDirect()) {
+            return this.addDirectBuffer(buffer);
+        }
+
+        byte[] array = new byte[buffer.remaining()];
+        buffer.duplicate().get(array);
+        return this.addBuffer(array);
+    }
+
     /**
      * Clear the scene of all added files.
      *
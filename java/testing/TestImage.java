@@ -1,5 +1,7 @@
 import app.f3d.F3D.*;
 
+import java.nio.ByteBuffer;
+
 public class TestImage {
 
   public static void main(String[] args) {
@@ -21,6 +23,55 @@ public class TestImage {
     img1.setContent(buffer);
     img1.getContent();
 
+    ByteBuffer directBuffer = ByteBuffer.allocateDirect(300 * 200 * 3);
+    img1.setContent(directBuffer);
+    img1.copyContent(directBuffer);
+    assert img1.getContentBuffer().capacity() == 300 * 200 * 3 : "Content buffer size is not valid";
+
+    try {
+      img1.copyContent(ByteBuffer.allocateDirect(10));
+      throw new RuntimeException("Expected IllegalArgumentException was not thrown");
+    } catch (IllegalArgumentException e) {
+      // expected
+    }
+
+    // Undersized buffers, direct or not, are rejected before reaching native code
+    for (ByteBuffer undersized :
+        new ByteBuffer[] { ByteBuffer.allocateDirect(10), ByteBuffer.allocate(10) }) {
+      try {
+        img1.setContent(undersized);
+        throw new RuntimeException("Expected IllegalArgumentException was not thrown");
+      } catch (IllegalArgumentException e) {
+        // expected
+      }
+    }
+
+    // Content is read from and written at the position of the buffers
+    for (ByteBuffer offsetBuffer : new ByteBuffer[] {
+        ByteBuffer.allocateDirect(300 * 200 * 3 + 4), ByteBuffer.allocate(300 * 200 * 3 + 4) }) {
+      offsetBuffer.put(4, (byte) 42);
+      offsetBuffer.position(4);
+      img1.setContent(offsetBuffer);
+      if (img1.getContent()[0] != 42 || offsetBuffer.position() != 4) {
+        throw new RuntimeException("Buffer position is not honored by setContent");
+      }
+    }
+
+    ByteBuffer positionedBuffer = ByteBuffer.allocateDirect(300 * 200 * 3 + 4);
+    positionedBuffer.position(4);
+    img1.copyContent(positionedBuffer);
+    if (positionedBuffer.get(4) != 42 || positionedBuffer.get(0) != 0) {
+      throw new RuntimeException("Buffer position is not honored by copyContent");
+    }
+
+    try {
+      positionedBuffer.position(5);
+      img1.copyContent(positionedBuffer);
+      throw new RuntimeException("Expected IllegalArgumentException was not thrown");
+    } catch (IllegalArgumentException e) {
+      // expected
+    }
+
     img1.getNormalizedPixel(10, 10);
 
     img1.save(tmpPath + "test.png");
@@ -2,6 +2,7 @@ import app.f3d.F3D.*;
 
 import java.io.*;
 import java.lang.String;
+import java.nio.ByteBuffer;
 
 public class TestSceneBuffer {
 
@@ -21,6 +22,12 @@ public class TestSceneBuffer {
     options.setAsString("scene.force_reader", "PLYReader");
     scene.add(new String(array).getBytes());
 
+    byte[] bytes = new String(array).getBytes();
+    ByteBuffer directBuffer = ByteBuffer.allocateDirect(bytes.length);
+    directBuffer.put(bytes).flip();
+    scene.add(directBuffer);
+    scene.add(ByteBuffer.wrap(bytes));
+
     engine.close();
   }
 }
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cctype>
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -178,6 +179,24 @@ public:
     return false;
   }
 
+  /**
+   * Return true if this reader only reads the arrays set with setRequiredArrays
+   * false otherwise
+   */
+  virtual bool supportsRequiredArrays() const
+  {
+    return false;
+  }
+
+  /**
+   * Set the names of the arrays needed to display the file, so that a reader supporting it
+   * can skip reading the others. std::nullopt, the default, requires all the arrays.
+   */
+  void setRequiredArrays(const std::optional<std::vector<std::string>>& names)
+  {
+    this->RequiredArrays = names;
+  }
+
   /**
    * Set a reader option
    * Return true if the option was found (and set), false otherwise
@@ -209,6 +228,7 @@ public:
 
 protected:
   std::map<std::string, std::string> ReaderOptions;
+  std::optional<std::vector<std::string>> RequiredArrays;
 };
 }
 
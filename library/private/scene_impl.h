@@ -37,6 +37,7 @@ public:
   scene& add(const mesh_t& mesh) override;
   scene& add(std::shared_ptr<mesh_view> mesh) override;
   scene& add(const std::byte* buffer, std::size_t size) override;
+  scene& reload(const std::filesystem::path& filePath) override;
   scene& clear() override;
   std::vector<std::filesystem::path> getAddedFiles() const override;
   int addLight(const light_state_t& lightState) const override;
@@ -67,6 +68,19 @@ public:
    */
   void PrintImporterDescription(log::VerboseLevel level);
 
+  /**
+   * Reload the files read with only the arrays required to display them, eg: the coloring array,
+   * with all their arrays. Return true if any file was reloaded.
+   */
+  bool LoadAllArrays();
+
+  /**
+   * Reload the files read with only the arrays required to display them if the options require
+   * arrays that were not read, eg: when the coloring array changed or when the metadata are
+   * displayed. Return true if any file was reloaded.
+   */
+  bool LoadRequiredArrays();
+
 private:
   class internals;
   std::unique_ptr<internals> Internals;
@@ -28,6 +28,8 @@ class options;
 
 namespace detail
 {
+class scene_impl;
+
 class window_impl : public window
 {
 public:
@@ -52,6 +54,12 @@ public:
   camera& getCamera() override;
   bool render() override;
   image renderToImage(bool noBackground = false) override;
+  bool renderToBuffer(
+    void* buffer, size_t bufferSize, size_t stride = 0, bool noBackground = false) override;
+  std::vector<image> renderViews(
+    const std::vector<camera_state_t>& states, bool noBackground = false) override;
+  bool renderViewsToBuffer(const std::vector<camera_state_t>& states, void* buffer,
+    size_t bufferSize, size_t stride = 0, bool noBackground = false) override;
   int getWidth() const override;
   int getHeight() const override;
   window& setSize(int width, int height) override;
@@ -136,6 +144,12 @@ public:
    */
   void SetInteractor(interactor_impl* interactor);
 
+  /**
+   * Implementation only API.
+   * Set the scene to reload when the options require arrays that were not read.
+   */
+  void SetScene(scene_impl* scene);
+
   /**
    * Trigger a render only of the UI
    * Does nothing if F3D_MODULE_UI is OFF
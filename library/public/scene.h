@@ -101,6 +101,15 @@ public:
   }
   ///@}
 
+  /**
+   * Reload a file previously added through the path-based add methods, in place.
+   * Only this file is imported again, the other files of the scene are kept as is,
+   * and the camera is not reset.
+   * If the file was not added to the scene, throw a load_failure_exception.
+   * If it fails to load the file, it clears the scene and throw a load_failure_exception.
+   */
+  virtual scene& reload(const std::filesystem::path& filePath) = 0;
+
   /**
    * Clear the scene of all added files
    */
@@ -8,6 +8,7 @@
 /// @cond
 #include <string>
 #include <utility>
+#include <vector>
 /// @endcond
 
 namespace f3d
@@ -84,6 +85,43 @@ public:
    */
   [[nodiscard]] virtual image renderToImage(bool noBackground = false) = 0;
 
+  /**
+   * Perform a render of the window to the screen and copy the result into a caller provided
+   * buffer, without allocating a f3d::image.
+   * Pixels are written with ChannelType BYTE and 3 or 4 components (RGB or RGBA),
+   * bottom row first, like renderToImage.
+   * Set noBackground to true to have a transparent background and 4 components.
+   * stride is the number of bytes between the start of two consecutive rows,
+   * 0 means rows are tightly packed.
+   * bufferSize must be at least stride * getHeight().
+   * Return true on success, false if the buffer is null or too small.
+   */
+  virtual bool renderToBuffer(
+    void* buffer, size_t bufferSize, size_t stride = 0, bool noBackground = false) = 0;
+
+  /**
+   * Render the scene once for each of the provided camera states and return the resulting
+   * f3d::image in the same order, see renderToImage.
+   * Dynamic options are updated only once before the first view, and the render passes,
+   * framebuffers and readback resources are reused between views,
+   * which makes this much faster than a loop setting the camera and calling renderToImage.
+   * The camera state is restored after rendering.
+   */
+  [[nodiscard]] virtual std::vector<image> renderViews(
+    const std::vector<camera_state_t>& states, bool noBackground = false) = 0;
+
+  /**
+   * Render the scene once for each of the provided camera states, like renderViews, and copy
+   * the results into a caller provided buffer, like renderToBuffer, without allocating any
+   * f3d::image. View i starts at i * stride * getHeight() bytes in the buffer.
+   * bufferSize must be at least states.size() * stride * getHeight(), it is checked before
+   * rendering so nothing is written on failure.
+   * The camera state is restored after rendering.
+   * Return true on success, false if the buffer is null or too small.
+   */
+  virtual bool renderViewsToBuffer(const std::vector<camera_state_t>& states, void* buffer,
+    size_t bufferSize, size_t stride = 0, bool noBackground = false) = 0;
+
   /**
    * Set the size of the window.
    */
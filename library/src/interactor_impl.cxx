@@ -22,6 +22,7 @@
 #include "vtkF3DUserEvents.h"
 
 #include <vtkCallbackCommand.h>
+#include <vtkCamera.h>
 #include <vtkCellPicker.h>
 #include <vtkGenericRenderWindowInteractor.h>
 #include <vtkMath.h>
@@ -621,19 +622,70 @@ public:
     ren->SetUIDeltaTime(deltaTime);
     ren->SetTotalTime(ren->GetTotalTime() + deltaTime);
 
-    // Determine if we need a full render or just a UI render
-    // At the moment, only TAA requires a full render each frame
-    bool forceRender = this->Options.render.effect.antialiasing.mode == "taa";
-
-    if (this->RenderRequested || forceRender)
+    // Determine if we need a full render, just a UI render or nothing at all,
+    // so that no GPU work is done while nothing changes
+    const bool useTAA = this->Options.render.effect.antialiasing.mode == "taa";
+    if (this->RenderRequested)
     {
-      this->Window.render();
       this->RenderRequested = false;
+      if (useTAA && this->IsTemporalAccumulationInvalidated(ren))
+      {
+        // The history is not relevant anymore, accumulate again from the new frame
+        ren->ResetTemporalAccumulation();
+      }
+      this->Window.render();
+    }
+    else if (useTAA && !ren->IsTemporalAccumulationConverged())
+    {
+      this->Window.render();
     }
     else
     {
-      this->Window.RenderUIOnly();
+      // The UI observer is modified when it received inputs that are drawn by the event loop.
+      // Draw one more frame after such inputs to let the UI settle its hovered states.
+      const vtkMTimeType uiObserverMTime = this->UIObserver->GetMTime();
+      if (uiObserverMTime > this->UIObserverTimeStamp)
+      {
+        this->UIObserverTimeStamp = uiObserverMTime;
+        this->UIFramesToRender = 2;
+      }
+
+      if (this->UIFramesToRender > 0 || ren->IsUIAnimated())
+      {
+        this->Window.RenderUIOnly();
+        this->UIFramesToRender = std::max(this->UIFramesToRender - 1, 0);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Check if the camera, the imported scene or the options may have changed since the last check.
+   * Options can only be changed by commands or by the API before requesting a render, which are
+   * counted by OptionsVersion, so they are not compared. Other render requests, such as animation
+   * ticks or UI changes, keep the temporal accumulation history so that it can converge.
+   */
+  bool IsTemporalAccumulationInvalidated(vtkF3DRenderer* ren)
+  {
+    bool invalidated = false;
+
+    const vtkMTimeType cameraMTime = ren->GetActiveCamera()->GetMTime();
+    vtkF3DMetaImporter* importer = ren->GetMetaImporter();
+    const vtkMTimeType sceneMTime = importer ? importer->GetMTime() : 0;
+    if (cameraMTime != this->TAACameraMTime || sceneMTime != this->TAASceneMTime)
+    {
+      this->TAACameraMTime = cameraMTime;
+      this->TAASceneMTime = sceneMTime;
+      invalidated = true;
+    }
+
+    const unsigned int optionsVersion = this->OptionsVersion;
+    if (optionsVersion != this->TAAOptionsVersion)
+    {
+      this->TAAOptionsVersion = optionsVersion;
+      invalidated = true;
     }
+    return invalidated;
   }
 
   //----------------------------------------------------------------------------
@@ -670,6 +722,16 @@ public:
   int EventLoopObserverId = -1;
   std::atomic<bool> RenderRequested = false;
   std::atomic<bool> StopRequested = false;
+  vtkMTimeType UIObserverTimeStamp = 0;
+  int UIFramesToRender = 0;
+
+  // State of the last temporal accumulation reset
+  vtkMTimeType TAACameraMTime = 0;
+  vtkMTimeType TAASceneMTime = 0;
+  unsigned int TAAOptionsVersion = 0;
+
+  // Incremented by the paths that may change the options: commands and API render requests
+  std::atomic<unsigned int> OptionsVersion = 0;
 
   double CallbackDeltaTime = 1.0 / 30; /* Default DeltaTime (30fps) */
 
@@ -999,6 +1061,11 @@ interactor& interactor_impl::initCommands()
     {
       check_args(args, 1, "cycle_coloring");
       std::string_view type = args[0];
+      if (type == "field" || type == "array")
+      {
+        // Files may have been read with only their coloring array, read the others to cycle
+        this->Internals->Scene.LoadAllArrays();
+      }
       vtkRenderWindow* renWin = this->Internals->Window.GetRenderWindow();
       vtkF3DRenderer* ren =
         vtkF3DRenderer::SafeDownCast(renWin->GetRenderers()->GetFirstRenderer());
@@ -1127,8 +1194,13 @@ interactor& interactor_impl::initCommands()
     command_documentation_t{ "print_coloring_info", "print information about coloring settings" });
 
   this->addCommand(
-    "print_mesh_info", [&](const std::vector<std::string>&)
-    { this->Internals->Scene.PrintImporterDescription(log::VerboseLevel::INFO); },
+    "print_mesh_info",
+    [&](const std::vector<std::string>&)
+    {
+      // Files may have been read with only their coloring array, read the others to list them
+      this->Internals->Scene.LoadAllArrays();
+      this->Internals->Scene.PrintImporterDescription(log::VerboseLevel::INFO);
+    },
     command_documentation_t{ "print_mesh_info", "print information from the mesh importer" });
 
   this->addCommand(
@@ -1499,6 +1571,7 @@ bool interactor_impl::triggerCommand(std::string_view command, bool keepComments
     if (callbackIt != this->Internals->Commands.end())
     {
       callbackIt->second.Callback({ tokens.begin() + 1, tokens.end() });
+      this->Internals->OptionsVersion++;
       return true;
     }
     else
@@ -2105,6 +2178,7 @@ interactor& interactor_impl::stop()
 //----------------------------------------------------------------------------
 interactor& interactor_impl::requestRender()
 {
+  this->Internals->OptionsVersion++;
   this->Internals->RenderRequested = true;
   return *this;
 }
@@ -104,20 +104,24 @@ public:
     data->timer->StartTimer();
   }
 
-  void Load(const std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>>& importers)
+  void Load(const std::vector<std::pair<std::string, vtkSmartPointer<vtkImporter>>>& importers,
+    bool resetCamera = true)
   {
     for (const auto& importer : importers)
     {
       this->MetaImporter->AddImporter(importer);
     }
 
-    // Initialize the camera on load
-    this->Window.InitializeUpDirection();
-
-    // Reset temporary up to apply any config values
-    if (this->Interactor)
+    if (resetCamera)
     {
-      this->Interactor->ResetTemporaryUp();
+      // Initialize the camera on load
+      this->Window.InitializeUpDirection();
+
+      // Reset temporary up to apply any config values
+      if (this->Interactor)
+      {
+        this->Interactor->ResetTemporaryUp();
+      }
     }
 
     if (this->Options.scene.camera.index.has_value())
@@ -146,6 +150,9 @@ public:
 
       this->MetaImporter->Clear();
       this->Window.Initialize();
+      this->AddedFiles.clear();
+      this->AddedFileImporters.clear();
+      this->AddedFileLoadedArrays.clear();
       throw scene::load_failure_exception("failed to load scene");
     }
 
@@ -159,7 +166,7 @@ public:
 
     // Update all window options and reset camera to bounds if needed
     this->Window.UpdateDynamicOptions();
-    if (!this->Options.scene.camera.index.has_value())
+    if (resetCamera && !this->Options.scene.camera.index.has_value())
     {
       this->Window.getCamera().resetToBounds();
     }
@@ -170,6 +177,101 @@ public:
     scene_impl::internals::DisplayAllInfo(this->MetaImporter, this->Window);
   }
 
+  /**
+   * Get the arrays to read to display a file with the current options, in addition to the
+   * provided arrays already read. Return nullopt to read all the arrays, which is needed when
+   * no coloring array is specified or when the metadata are displayed.
+   */
+  std::optional<std::vector<std::string>> GetRequiredArrays(
+    const std::optional<std::vector<std::string>>& loadedArrays = std::vector<std::string>()) const
+  {
+    const std::optional<std::string>& arrayName = this->Options.model.scivis.array_name;
+    if (!loadedArrays.has_value() || !arrayName.has_value() || this->Options.ui.metadata)
+    {
+      return std::nullopt;
+    }
+
+    std::vector<std::string> arrays = loadedArrays.value();
+    if (std::find(arrays.begin(), arrays.end(), arrayName.value()) == arrays.end())
+    {
+      arrays.emplace_back(arrayName.value());
+    }
+    return arrays;
+  }
+
+  /**
+   * Create the importer of a file, reading only the provided arrays if the reader supports it.
+   * The arrays are set to nullopt if all the arrays are read.
+   */
+  vtkSmartPointer<vtkImporter> CreateImporter(
+    const fs::path& filePath, std::optional<std::vector<std::string>>& requiredArrays)
+  {
+    if (!vtksys::SystemTools::FileExists(filePath.string(), true))
+    {
+      throw scene::load_failure_exception(filePath.string() + " does not exists");
+    }
+    std::optional<std::string> forceReader = this->Options.scene.force_reader;
+    // Recover the importer for the provided file path
+    f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
+    if (reader)
+    {
+      if (forceReader)
+      {
+        log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
+      }
+      else
+      {
+        log::debug("Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
+      }
+    }
+    else
+    {
+      if (forceReader)
+      {
+        throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
+      }
+      throw scene::load_failure_exception(filePath.string() +
+        " is not a file of a supported 3D scene file format, use force reader to force a specific "
+        "reader");
+    }
+
+    // Only the coloring array is needed to display the file when it is known,
+    // other arrays are read when the options require them
+    reader->setRequiredArrays(requiredArrays);
+    if (!reader->supportsRequiredArrays())
+    {
+      requiredArrays = std::nullopt;
+    }
+
+    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
+    if (!importer)
+    {
+      // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
+      auto vtkReader = reader->createGeometryReader(filePath.string());
+      assert(vtkReader);
+      vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
+        vtkSmartPointer<vtkF3DGenericImporter>::New();
+      genericImporter->SetInternalReader(vtkReader);
+      importer = genericImporter;
+    }
+    return importer;
+  }
+
+  void ReplaceFileImporter(size_t index, std::optional<std::vector<std::string>> requiredArrays)
+  {
+    const fs::path& filePath = this->AddedFiles[index];
+    vtkSmartPointer<vtkImporter> importer = this->CreateImporter(filePath, requiredArrays);
+
+    log::debug("\nReloading file: ", filePath.string(), "\n");
+
+    // Only the actors of the replaced importer are recreated, other importers are not updated
+    // again
+    this->MetaImporter->ReplaceImporter(
+      this->AddedFileImporters[index], { filePath.filename().string(), importer });
+    this->AddedFileImporters[index] = importer;
+    this->AddedFileLoadedArrays[index] = requiredArrays;
+  }
+
   static void DisplayImporterDescription(log::VerboseLevel level, vtkImporter* importer)
   {
     vtkIdType availCameras = importer->GetNumberOfCameras();
@@ -209,16 +311,28 @@ public:
 
   vtkNew<vtkF3DMetaImporter> MetaImporter;
   std::vector<fs::path> AddedFiles;
+
+  // Importers of AddedFiles, in the same order, so that a single file can be reloaded
+  std::vector<vtkSmartPointer<vtkImporter>> AddedFileImporters;
+
+  // Arrays read from AddedFiles when they were read with only the arrays required to display
+  // them, nullopt if all the arrays were read
+  std::vector<std::optional<std::vector<std::string>>> AddedFileLoadedArrays;
 };
 
 //----------------------------------------------------------------------------
 scene_impl::scene_impl(options& options, window_impl& window)
   : Internals(std::make_unique<scene_impl::internals>(options, window))
 {
+  // window need the scene to read the arrays required by its options
+  this->Internals->Window.SetScene(this);
 }
 
 //----------------------------------------------------------------------------
-scene_impl::~scene_impl() = default;
+scene_impl::~scene_impl()
+{
+  this->Internals->Window.SetScene(nullptr);
+}
 
 //----------------------------------------------------------------------------
 scene& scene_impl::add(const fs::path& filePath)
@@ -253,49 +367,15 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
       continue;
     }
 
-    if (!vtksys::SystemTools::FileExists(filePath.string(), true))
-    {
-      throw scene::load_failure_exception(filePath.string() + " does not exists");
-    }
-    std::optional<std::string> forceReader = this->Internals->Options.scene.force_reader;
-    // Recover the importer for the provided file path
-    const f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
-    if (reader)
-    {
-      if (forceReader)
-      {
-        log::debug("Forcing reader ", (*forceReader), " for ", filePath.string());
-      }
-      else
-      {
-        log::debug("Found a reader for \"", filePath.string(), "\" : \"", reader->getName(), "\"");
-      }
-    }
-    else
-    {
-      if (forceReader)
-      {
-        throw scene::load_failure_exception(*forceReader + " is not a valid force reader");
-      }
-      throw scene::load_failure_exception(filePath.string() +
-        " is not a file of a supported 3D scene file format, use force reader to force a specific "
-        "reader");
-    }
-
-    vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
-    if (!importer)
-    {
-      // XXX: F3D Plugin CMake logic ensure there is either a scene reader or a geometry reader
-      auto vtkReader = reader->createGeometryReader(filePath.string());
-      assert(vtkReader);
-      vtkSmartPointer<vtkF3DGenericImporter> genericImporter =
-        vtkSmartPointer<vtkF3DGenericImporter>::New();
-      genericImporter->SetInternalReader(vtkReader);
-      importer = genericImporter;
-    }
+    std::optional<std::vector<std::string>> requiredArrays =
+      this->Internals->GetRequiredArrays();
+    vtkSmartPointer<vtkImporter> importer =
+      this->Internals->CreateImporter(filePath, requiredArrays);
     importers.emplace_back(filePath.filename().string(), importer);
 
     this->Internals->AddedFiles.emplace_back(filePath);
+    this->Internals->AddedFileImporters.emplace_back(importer);
+    this->Internals->AddedFileLoadedArrays.emplace_back(requiredArrays);
   }
 
   log::debug("\nLoading files: ");
@@ -336,7 +416,7 @@ scene& scene_impl::add(const std::byte* buffer, std::size_t size)
   }
 #endif
 
-  const f3d::reader* reader = f3d::factory::instance()->getReader(buffer, size, forceReader);
+  f3d::reader* reader = f3d::factory::instance()->getReader(buffer, size, forceReader);
   if (reader)
   {
     if (forceReader)
@@ -361,6 +441,9 @@ scene& scene_impl::add(const std::byte* buffer, std::size_t size)
   vtkNew<vtkMemoryResourceStream> stream;
   stream->SetBuffer(buffer, size);
 
+  // A stream cannot be read again when cycling the coloring, read all its arrays
+  reader->setRequiredArrays(std::nullopt);
+
   vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(stream);
   if (!importer)
   {
@@ -750,6 +833,72 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
 #endif
 }
 
+//----------------------------------------------------------------------------
+scene& scene_impl::reload(const fs::path& filePath)
+{
+  std::vector<fs::path>& addedFiles = this->Internals->AddedFiles;
+  auto fileIt = std::find(addedFiles.begin(), addedFiles.end(), filePath);
+  if (fileIt == addedFiles.end())
+  {
+    throw scene::load_failure_exception(filePath.string() + " was not added to the scene");
+  }
+  const size_t index = static_cast<size_t>(std::distance(addedFiles.begin(), fileIt));
+
+  this->Internals->ReplaceFileImporter(
+    index, this->Internals->GetRequiredArrays(this->Internals->AddedFileLoadedArrays[index]));
+  this->Internals->Load({}, false);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+bool scene_impl::LoadAllArrays()
+{
+  bool reloaded = false;
+  for (size_t i = 0; i < this->Internals->AddedFiles.size(); i++)
+  {
+    if (this->Internals->AddedFileLoadedArrays[i].has_value())
+    {
+      this->Internals->ReplaceFileImporter(i, std::nullopt);
+      reloaded = true;
+    }
+  }
+
+  if (reloaded)
+  {
+    this->Internals->Load({}, false);
+  }
+  return reloaded;
+}
+
+//----------------------------------------------------------------------------
+bool scene_impl::LoadRequiredArrays()
+{
+  bool reloaded = false;
+  for (size_t i = 0; i < this->Internals->AddedFiles.size(); i++)
+  {
+    const std::optional<std::vector<std::string>>& loadedArrays =
+      this->Internals->AddedFileLoadedArrays[i];
+    if (!loadedArrays.has_value())
+    {
+      continue;
+    }
+
+    std::optional<std::vector<std::string>> requiredArrays =
+      this->Internals->GetRequiredArrays(loadedArrays);
+    if (requiredArrays != loadedArrays)
+    {
+      this->Internals->ReplaceFileImporter(i, requiredArrays);
+      reloaded = true;
+    }
+  }
+
+  if (reloaded)
+  {
+    this->Internals->Load({}, false);
+  }
+  return reloaded;
+}
+
 //----------------------------------------------------------------------------
 scene& scene_impl::clear()
 {
@@ -760,6 +909,8 @@ scene& scene_impl::clear()
   this->Internals->Window.Initialize();
 
   this->Internals->AddedFiles.clear();
+  this->Internals->AddedFileImporters.clear();
+  this->Internals->AddedFileLoadedArrays.clear();
 
   // Clear animation state
   this->Internals->AnimationManager.Reset();
@@ -6,6 +6,7 @@
 #include "log.h"
 #include "macros.h"
 #include "options.h"
+#include "scene_impl.h"
 #include "utils.h"
 
 #include "F3DStyle.h"
@@ -18,7 +19,6 @@
 #include <vtkCamera.h>
 #include <vtkF3DRenderPass.h>
 #include <vtkImageData.h>
-#include <vtkImageExport.h>
 #include <vtkInformation.h>
 #include <vtkPNGReader.h>
 #include <vtkPointGaussianMapper.h>
@@ -50,6 +50,8 @@
 
 #include <vtkOSOpenGLRenderWindow.h>
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 namespace fs = std::filesystem;
@@ -115,11 +117,102 @@ public:
 #endif
   }
 
+  /**
+   * Camera wasn't successfully reset last time, it could be a chance that update of dynamic
+   * options will enable successful reset of camera.
+   * Should be called after updating dynamic options and before rendering.
+   */
+  void RetryCameraReset()
+  {
+    if ((!this->Options.scene.camera.index.has_value()) && (!this->Camera->GetSuccessfullyReset()))
+    {
+      this->Camera->resetToBounds();
+    }
+  }
+
+  /**
+   * Render the window through the window to image filter and read back its content.
+   * The filter is kept between calls so that its output buffer is reused
+   * as long as the window size does not change.
+   */
+  vtkImageData* ReadBack(bool noBackground)
+  {
+    this->ImageFilter->SetInput(this->RenWin);
+    if (noBackground)
+    {
+      // we need to set the background to black to avoid blending issues with translucent
+      // objects when saving to file with no background
+      this->Renderer->SetBackground(0, 0, 0);
+      this->ImageFilter->SetInputBufferTypeToRGBA();
+    }
+    else
+    {
+      this->ImageFilter->SetInputBufferTypeToRGB();
+    }
+
+    // the render window content is not tracked by the pipeline
+    this->ImageFilter->Modified();
+    this->ImageFilter->Update();
+    return this->ImageFilter->GetOutput();
+  }
+
+  /**
+   * Render the window and read its content back directly into a buffer, bottom row first,
+   * rows being separated by stride bytes. The buffer must fit stride * height bytes.
+   */
+  void ReadBackToBuffer(unsigned char* buffer, size_t stride, bool noBackground)
+  {
+    if (noBackground)
+    {
+      // see ReadBack
+      this->Renderer->SetBackground(0, 0, 0);
+    }
+    this->RenWin->Render();
+
+    const int* size = this->RenWin->GetSize();
+    const size_t rowSize = static_cast<size_t>(size[0]) * (noBackground ? 4 : 3);
+    if (noBackground)
+    {
+      this->RenWin->GetRGBACharPixelData(0, 0, size[0] - 1, size[1] - 1, 1, buffer);
+    }
+    else
+    {
+      this->RenWin->GetPixelData(0, 0, size[0] - 1, size[1] - 1, 1, buffer);
+    }
+
+    // Rows are read tightly packed, spread them from the last one so none is overwritten
+    if (stride != rowSize)
+    {
+      for (int row = size[1] - 1; row > 0; row--)
+      {
+        std::memmove(buffer + row * stride, buffer + row * rowSize, rowSize);
+      }
+    }
+  }
+
+  /**
+   * Read back the content of the render window into a new image.
+   */
+  image ReadBackImage(bool noBackground)
+  {
+    vtkImageData* data = this->ReadBack(noBackground);
+    const int* dims = data->GetDimensions();
+    int cmp = data->GetNumberOfScalarComponents();
+
+    image output(dims[0], dims[1], cmp);
+    std::copy_n(static_cast<const unsigned char*>(data->GetScalarPointer()),
+      static_cast<size_t>(dims[0]) * dims[1] * cmp,
+      static_cast<unsigned char*>(output.getContent()));
+    return output;
+  }
+
   std::unique_ptr<camera_impl> Camera;
   vtkSmartPointer<vtkRenderWindow> RenWin;
   vtkNew<vtkF3DRenderer> Renderer;
+  vtkNew<vtkWindowToImageFilter> ImageFilter;
   const options& Options;
   interactor_impl* Interactor = nullptr;
+  scene_impl* Scene = nullptr;
   fs::path CachePath;
   context::function GetProcAddress;
 #if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 7, 20260724)
@@ -456,6 +549,13 @@ void window_impl::UpdateActorsVisibility()
 //----------------------------------------------------------------------------
 void window_impl::UpdateDynamicOptions()
 {
+  // Read the arrays required by the options that were not read when adding the files,
+  // reloading them updates the dynamic options again
+  if (this->Internals->Scene && this->Internals->Scene->LoadRequiredArrays())
+  {
+    return;
+  }
+
   vtkF3DRenderer* renderer = this->Internals->Renderer;
 
   if (this->Internals->RenWin->IsA("vtkF3DNoRenderWindow"))
@@ -670,6 +770,8 @@ void window_impl::UpdateDynamicOptions()
 
   renderer->SetBackground(opt.render.background.color.data());
   renderer->SetUseBlurBackground(opt.render.background.blur.enable);
+  renderer->SetUseProgressiveRendering(opt.render.progressive.enable);
+  renderer->SetUseLevelOfDetail(opt.render.lod.enable);
   renderer->SetBlurCircleOfConfusionRadius(opt.render.background.blur.coc);
   renderer->SetLightIntensity(opt.render.light.intensity);
 
@@ -795,13 +897,7 @@ vtkRenderWindow* window_impl::GetRenderWindow()
 bool window_impl::render()
 {
   this->UpdateDynamicOptions();
-  const options& opt = this->Internals->Options;
-  if ((!opt.scene.camera.index.has_value()) && (!this->Internals->Camera->GetSuccessfullyReset()))
-  {
-    // Camera wasn't successfully reset last time, it could be a chance that update of dynamic
-    // options will enable successful reset of camera
-    this->Internals->Camera->resetToBounds();
-  }
+  this->Internals->RetryCameraReset();
   this->Internals->RenWin->Render();
   return true;
 }
@@ -809,30 +905,120 @@ bool window_impl::render()
 //----------------------------------------------------------------------------
 image window_impl::renderToImage(bool noBackground)
 {
+  this->render();
+  return this->Internals->ReadBackImage(noBackground);
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::renderToBuffer(void* buffer, size_t bufferSize, size_t stride, bool noBackground)
+{
+  if (!buffer)
+  {
+    log::error("Cannot render to a null buffer");
+    return false;
+  }
+
   this->render();
 
-  vtkNew<vtkWindowToImageFilter> rtW2if;
-  rtW2if->SetInput(this->Internals->RenWin);
+  vtkImageData* data = this->Internals->ReadBack(noBackground);
+  const int* dims = data->GetDimensions();
+  const size_t rowSize = static_cast<size_t>(dims[0]) * data->GetNumberOfScalarComponents();
+  stride = stride == 0 ? rowSize : stride;
 
-  if (noBackground)
+  if (stride < rowSize || bufferSize < stride * dims[1])
   {
-    // we need to set the background to black to avoid blending issues with translucent
-    // objects when saving to file with no background
-    this->Internals->Renderer->SetBackground(0, 0, 0);
-    rtW2if->SetInputBufferTypeToRGBA();
+    log::error("Provided buffer is too small to render a ", dims[0], "x", dims[1], " image");
+    return false;
   }
 
-  vtkNew<vtkImageExport> exporter;
-  exporter->SetInputConnection(rtW2if->GetOutputPort());
-  exporter->ImageLowerLeftOn();
+  const auto* src = static_cast<const unsigned char*>(data->GetScalarPointer());
+  auto* dst = static_cast<unsigned char*>(buffer);
+  if (stride == rowSize)
+  {
+    std::copy_n(src, rowSize * dims[1], dst);
+  }
+  else
+  {
+    for (int row = 0; row < dims[1]; row++)
+    {
+      std::copy_n(src + row * rowSize, rowSize, dst + row * stride);
+    }
+  }
 
-  const int* dims = exporter->GetDataDimensions();
-  int cmp = exporter->GetDataNumberOfScalarComponents();
+  return true;
+}
 
-  image output(dims[0], dims[1], cmp);
-  exporter->Export(output.getContent());
+//----------------------------------------------------------------------------
+std::vector<image> window_impl::renderViews(
+  const std::vector<camera_state_t>& states, bool noBackground)
+{
+  std::vector<image> images;
+  images.reserve(states.size());
+  if (states.empty())
+  {
+    return images;
+  }
+
+  // Options cannot change between views, so they are only evaluated once,
+  // with the same camera reset logic as render
+  this->UpdateDynamicOptions();
+  this->Internals->RetryCameraReset();
 
-  return output;
+  camera& cam = this->getCamera();
+  const camera_state_t initialState = cam.getState();
+  for (const camera_state_t& state : states)
+  {
+    cam.setState(state);
+
+    // The readback renders the window with the new camera
+    images.emplace_back(this->Internals->ReadBackImage(noBackground));
+  }
+  cam.setState(initialState);
+
+  return images;
+}
+
+//----------------------------------------------------------------------------
+bool window_impl::renderViewsToBuffer(const std::vector<camera_state_t>& states, void* buffer,
+  size_t bufferSize, size_t stride, bool noBackground)
+{
+  if (!buffer)
+  {
+    log::error("Cannot render to a null buffer");
+    return false;
+  }
+
+  // The size is checked before rendering so that nothing is written in a too small buffer
+  const int* size = this->Internals->RenWin->GetSize();
+  const size_t rowSize = static_cast<size_t>(size[0]) * (noBackground ? 4 : 3);
+  stride = stride == 0 ? rowSize : stride;
+  const size_t viewSize = stride * size[1];
+  if (stride < rowSize || bufferSize < states.size() * viewSize)
+  {
+    log::error("Provided buffer is too small to render ", states.size(), " views of ", size[0],
+      "x", size[1]);
+    return false;
+  }
+  if (states.empty())
+  {
+    return true;
+  }
+
+  // Same logic as renderViews, without any intermediate image
+  this->UpdateDynamicOptions();
+  this->Internals->RetryCameraReset();
+
+  camera& cam = this->getCamera();
+  const camera_state_t initialState = cam.getState();
+  auto* dst = static_cast<unsigned char*>(buffer);
+  for (size_t i = 0; i < states.size(); i++)
+  {
+    cam.setState(states[i]);
+    this->Internals->ReadBackToBuffer(dst + i * viewSize, stride, noBackground);
+  }
+  cam.setState(initialState);
+
+  return true;
 }
 
 //----------------------------------------------------------------------------
@@ -874,6 +1060,12 @@ void window_impl::SetInteractor(interactor_impl* interactor)
   this->Internals->Interactor = interactor;
 }
 
+//----------------------------------------------------------------------------
+void window_impl::SetScene(scene_impl* scene)
+{
+  this->Internals->Scene = scene;
+}
+
 //----------------------------------------------------------------------------
 void window_impl::RenderUIOnly()
 {
@@ -102,6 +102,17 @@ int TestSDKScene([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
   test("render after add",
     TestSDKHelpers::RenderTest(win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKScene"));
 
+  // reload test
+  test.expect<f3d::scene::load_failure_exception>(
+    "reload a file that was not added", [&]() { sce.reload(fs::path(validFilename)); });
+  f3d::camera_state_t stateBeforeReload = win.getCamera().getState();
+  test("reload a single added file", [&]() { sce.reload(fs::path(sphere1)); });
+  test("reload keeps added files", sce.getAddedFiles().size() == 5);
+  test("reload does not reset the camera",
+    win.getCamera().getState().position == stateBeforeReload.position);
+  test("render after reload",
+    TestSDKHelpers::RenderTest(win, std::string(argv[1]) + "baselines/", argv[2], "TestSDKScene"));
+
   // light test
   f3d::light_state_t defaultLight;
   f3d::light_state_t redLight = defaultLight;
@@ -6,6 +6,9 @@
 #include <options.h>
 #include <window.h>
 
+#include <algorithm>
+#include <vector>
+
 int TestSDKWindowAuto([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 {
   PseudoUnitTest test;
@@ -39,5 +42,50 @@ int TestSDKWindowAuto([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
     TestSDKHelpers::RenderTest(
       win, std::string(argv[1]) + "baselines/", std::string(argv[2]), "TestSDKWindowStandard"));
 
+  // render to a caller provided buffer with padded rows
+  f3d::image img = win.renderToImage();
+  const size_t rowSize = static_cast<size_t>(width) * 3;
+  const size_t stride = rowSize + 4;
+  std::vector<unsigned char> buffer(stride * height);
+  test(
+    "render to a too small buffer", !win.renderToBuffer(buffer.data(), buffer.size() - 1, stride));
+  test("render to a null buffer", !win.renderToBuffer(nullptr, buffer.size(), stride));
+  test("render to buffer", win.renderToBuffer(buffer.data(), buffer.size(), stride));
+
+  const auto* content = static_cast<const unsigned char*>(img.getContent());
+  bool same = true;
+  for (int row = 0; row < height; row++)
+  {
+    same &= std::equal(content + row * rowSize, content + (row + 1) * rowSize,
+      buffer.begin() + row * stride);
+  }
+  test("render to buffer content matches render to image", same);
+
+  // render several views to a caller provided buffer with padded rows
+  f3d::camera_state_t state = win.getCamera().getState();
+  std::vector<f3d::camera_state_t> states = { state, state };
+  states[1].position[0] += 1.0;
+  std::vector<f3d::image> images = win.renderViews(states);
+  const size_t viewSize = stride * height;
+  std::vector<unsigned char> views(2 * viewSize, 0x7f);
+  test("render views to a too small buffer",
+    !win.renderViewsToBuffer(states, views.data(), views.size() - 1, stride));
+  test("render views to a too small buffer does not write",
+    std::all_of(views.begin(), views.end(), [](unsigned char v) { return v == 0x7f; }));
+  test("render views to buffer",
+    win.renderViewsToBuffer(states, views.data(), views.size(), stride));
+
+  same = images.size() == 2;
+  for (size_t i = 0; same && i < images.size(); i++)
+  {
+    const auto* viewContent = static_cast<const unsigned char*>(images[i].getContent());
+    for (int row = 0; row < height; row++)
+    {
+      same &= std::equal(viewContent + row * rowSize, viewContent + (row + 1) * rowSize,
+        views.begin() + i * viewSize + row * stride);
+    }
+  }
+  test("render views to buffer content matches render views", same);
+
   return test.result();
 }
@@ -28,6 +28,7 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
 #include <numeric>
 #include <stack>
 #include <tuple>
@@ -197,9 +198,39 @@ class vtkF3DAlembicReader::vtkInternals
   }
 
 public:
-  std::map<std::string, vtkSmartPointer<vtkPolyData>> OutputCache;
-  vtkSmartPointer<vtkPolyData> ProcessIPolyMesh(
-    const Alembic::AbcGeom::IPolyMesh& pmesh, double time, const Alembic::Abc::M44d& matrix)
+  /**
+   * How an object changes over time, deciding what is read again for each time value
+   */
+  enum class ObjectVariance
+  {
+    Static,           // constant geometry and transforms, read once
+    TransformOnly,    // constant geometry with animated transforms, only transformed
+    Deforming,        // constant topology, only positions and normals are read
+    TopologyChanging, // read entirely
+  };
+
+  /**
+   * A polygonal mesh or curves of the archive, classified once and with its last output
+   */
+  struct ObjectEntry
+  {
+    Alembic::Abc::IObject Object;
+    bool IsCurves = false;
+    std::vector<Alembic::AbcGeom::IXform> Xforms; // ancestors, from the root
+    ObjectVariance Variance = ObjectVariance::Static;
+    Alembic::Abc::M44d Matrix;
+    vtkSmartPointer<vtkPolyData> Local; // untransformed output of TransformOnly objects
+    vtkSmartPointer<vtkPolyData> Output;
+    vtkIdType PointOffset = 0; // offset of the points of the object in the merged output
+  };
+
+  /**
+   * Read a polygonal mesh, with its points transformed by matrix.
+   * If a previous output of a mesh with constant topology is provided, only positions and
+   * normals are read and its cells and other attributes are reused.
+   */
+  vtkSmartPointer<vtkPolyData> ProcessIPolyMesh(const Alembic::AbcGeom::IPolyMesh& pmesh,
+    double time, const Alembic::Abc::M44d& matrix, vtkPolyData* cachedPoly = nullptr)
   {
     vtkNew<vtkPolyData> polydata;
     IntermediateGeometry originalData;
@@ -214,15 +245,10 @@ public:
 
     Alembic::AbcGeom::ISampleSelector selector(time);
     schema.get(samp, selector);
-    const std::string& meshName = pmesh.getName();
-    auto topologyVariance = schema.getTopologyVariance();
-    bool isTopologyConstant = (topologyVariance == Alembic::AbcGeom::kConstantTopology) ||
-      (topologyVariance == Alembic::AbcGeom::kHomogenousTopology);
     Alembic::AbcGeom::P3fArraySamplePtr positions = samp.getPositions();
 
-    if (isTopologyConstant && this->OutputCache.count(meshName))
+    if (cachedPoly)
     {
-      vtkPolyData* cachedPoly = this->OutputCache[meshName];
       polydata->ShallowCopy(cachedPoly);
 
       vtkIdTypeArray* sourceIds =
@@ -377,12 +403,6 @@ public:
         faceVaryingFilter->Update();
         polydata->ShallowCopy(faceVaryingFilter->GetOutput());
       }
-
-      // Store data for the next frame
-      if (isTopologyConstant)
-      {
-        this->OutputCache[meshName] = polydata;
-      }
     }
     return polydata;
   }
@@ -435,52 +455,279 @@ public:
     return polydata;
   }
 
-  void ImportRoot(vtkAppendPolyData* append, double time)
+  /**
+   * Flatten the meshes and curves of the archive and classify them by variance
+   */
+  void ClassifyObjects()
   {
-    const Alembic::Abc::IObject top = this->Archive.getTop();
-    const Alembic::AbcGeom::ISampleSelector selector(time);
-    Alembic::Abc::M44d identity;
-    identity.makeIdentity();
+    this->Objects.clear();
+    this->Merged = nullptr;
 
-    std::stack<std::tuple<const Alembic::Abc::IObject, const Alembic::Abc::ObjectHeader,
-      const Alembic::Abc::M44d>>
+    const Alembic::Abc::IObject top = this->Archive.getTop();
+    using Xforms = std::vector<Alembic::AbcGeom::IXform>;
+    std::stack<std::tuple<const Alembic::Abc::IObject, const Alembic::Abc::ObjectHeader, Xforms>>
       objects;
 
     for (size_t i = 0; i < top.getNumChildren(); ++i)
     {
-      objects.emplace(std::make_tuple(top, top.getChildHeader(i), identity));
+      objects.emplace(std::make_tuple(top, top.getChildHeader(i), Xforms()));
     }
 
     while (!objects.empty())
     {
-      const auto& [parent, ohead, matrix] = objects.top();
+      auto [parent, ohead, xforms] = objects.top();
+      objects.pop();
       const Alembic::AbcGeom::IObject obj(parent, ohead.getName());
-      Alembic::Abc::M44d objMatrix = matrix;
+
+      const bool xformsConstant = std::ranges::all_of(xforms,
+        [](const Alembic::AbcGeom::IXform& xform) { return xform.getSchema().isConstant(); });
       if (Alembic::AbcGeom::IPolyMesh::matches(ohead))
       {
         const Alembic::AbcGeom::IPolyMesh polymesh(parent, ohead.getName());
-        append->AddInputData(this->ProcessIPolyMesh(polymesh, time, objMatrix));
+        const Alembic::AbcGeom::IPolyMeshSchema& schema = polymesh.getSchema();
+
+        ObjectEntry entry{ polymesh, false, xforms };
+        if (schema.getNumSamples() <= 1)
+        {
+          entry.Variance = xformsConstant ? ObjectVariance::Static : ObjectVariance::TransformOnly;
+        }
+        else
+        {
+          auto topologyVariance = schema.getTopologyVariance();
+          entry.Variance = topologyVariance == Alembic::AbcGeom::kHeterogenousTopology
+            ? ObjectVariance::TopologyChanging
+            : ObjectVariance::Deforming;
+        }
+        this->Objects.emplace_back(std::move(entry));
       }
       else if (Alembic::AbcGeom::ICurves::matches(ohead))
       {
-        const Alembic::AbcGeom::ICurves curve(parent, ohead.getName());
-        append->AddInputData(this->ProcessICurves(curve, time, objMatrix));
+        const Alembic::AbcGeom::ICurves curves(parent, ohead.getName());
+
+        ObjectEntry entry{ curves, true, xforms };
+        if (curves.getSchema().getNumSamples() <= 1)
+        {
+          entry.Variance = xformsConstant ? ObjectVariance::Static : ObjectVariance::TransformOnly;
+        }
+        else
+        {
+          entry.Variance = ObjectVariance::TopologyChanging;
+        }
+        this->Objects.emplace_back(std::move(entry));
       }
       else if (Alembic::AbcGeom::IXform::matches(ohead))
       {
-        const Alembic::AbcGeom::IXform xForm(parent, ohead.getName());
-        const Alembic::AbcGeom::IXformSchema& xFormSchema = xForm.getSchema();
-        Alembic::AbcGeom::XformSample xFormSamp;
-        xFormSchema.get(xFormSamp, selector);
-        objMatrix = xFormSamp.getMatrix() * matrix;
+        xforms.emplace_back(parent, ohead.getName());
       }
 
-      objects.pop();
       for (size_t i = 0; i < obj.getNumChildren(); ++i)
       {
-        objects.emplace(std::make_tuple(obj, obj.getChildHeader(i), objMatrix));
+        objects.emplace(std::make_tuple(obj, obj.getChildHeader(i), xforms));
+      }
+    }
+  }
+
+  /**
+   * Compute the matrix of an object at the provided time from its ancestors transforms
+   */
+  static Alembic::Abc::M44d ComputeMatrix(const ObjectEntry& entry, double time)
+  {
+    const Alembic::AbcGeom::ISampleSelector selector(time);
+    Alembic::Abc::M44d matrix;
+    matrix.makeIdentity();
+    for (const Alembic::AbcGeom::IXform& xform : entry.Xforms)
+    {
+      Alembic::AbcGeom::XformSample xFormSamp;
+      xform.getSchema().get(xFormSamp, selector);
+      matrix = xFormSamp.getMatrix() * matrix;
+    }
+    return matrix;
+  }
+
+  /**
+   * Read an object entirely, with its points transformed by matrix
+   */
+  vtkSmartPointer<vtkPolyData> ReadObject(
+    const ObjectEntry& entry, double time, const Alembic::Abc::M44d& matrix)
+  {
+    if (entry.IsCurves)
+    {
+      return this->ProcessICurves(
+        Alembic::AbcGeom::ICurves(entry.Object, Alembic::Abc::kWrapExisting), time, matrix);
+    }
+    return this->ProcessIPolyMesh(
+      Alembic::AbcGeom::IPolyMesh(entry.Object, Alembic::Abc::kWrapExisting), time, matrix);
+  }
+
+  /**
+   * Transform the points and normals of an untransformed output by matrix
+   */
+  static vtkSmartPointer<vtkPolyData> TransformOutput(
+    vtkPolyData* local, const Alembic::Abc::M44d& matrix)
+  {
+    vtkSmartPointer<vtkPolyData> polydata = vtkSmartPointer<vtkPolyData>::New();
+    polydata->ShallowCopy(local);
+
+    vtkPoints* localPoints = local->GetPoints();
+    if (!localPoints)
+    {
+      return polydata;
+    }
+
+    const vtkIdType numPoints = localPoints->GetNumberOfPoints();
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(numPoints);
+    for (vtkIdType i = 0; i < numPoints; i++)
+    {
+      double p[3];
+      localPoints->GetPoint(i, p);
+      Alembic::Abc::V3d tp;
+      matrix.multVecMatrix(Alembic::Abc::V3d(p[0], p[1], p[2]), tp);
+      points->SetPoint(i, tp.x, tp.y, tp.z);
+    }
+    polydata->SetPoints(points);
+
+    vtkDataArray* localNormals = local->GetPointData()->GetNormals();
+    if (localNormals)
+    {
+      vtkNew<vtkFloatArray> normals;
+      normals->SetName(localNormals->GetName());
+      normals->SetNumberOfComponents(3);
+      normals->SetNumberOfTuples(localNormals->GetNumberOfTuples());
+      for (vtkIdType i = 0; i < normals->GetNumberOfTuples(); i++)
+      {
+        double n[3];
+        localNormals->GetTuple(i, n);
+        Alembic::Abc::V3d normal;
+        matrix.multDirMatrix(Alembic::Abc::V3d(n[0], n[1], n[2]), normal);
+        normals->SetTuple3(i, normal.x, normal.y, normal.z);
+      }
+      polydata->GetPointData()->SetNormals(normals);
+    }
+    return polydata;
+  }
+
+  /**
+   * Update the objects for the provided time and return all of them merged.
+   * Only objects that change over time are read again, and as long as no topology changes
+   * the merged output is updated by copying the points and normals of the updated objects
+   * instead of merging everything again.
+   */
+  vtkSmartPointer<vtkPolyData> ImportRoot(double time)
+  {
+    if (this->Objects.empty())
+    {
+      this->ClassifyObjects();
+    }
+
+    bool remerge = !this->Merged;
+    std::vector<const ObjectEntry*> updated;
+    for (ObjectEntry& entry : this->Objects)
+    {
+      const bool firstRead = !entry.Output;
+      const vtkIdType numPoints = firstRead ? 0 : entry.Output->GetNumberOfPoints();
+      if (!firstRead && entry.Variance == ObjectVariance::Static)
+      {
+        continue;
+      }
+
+      Alembic::Abc::M44d matrix = ComputeMatrix(entry, time);
+      switch (entry.Variance)
+      {
+        case ObjectVariance::Static:
+          entry.Output = this->ReadObject(entry, time, matrix);
+          break;
+        case ObjectVariance::TransformOnly:
+          if (!firstRead && matrix == entry.Matrix)
+          {
+            continue;
+          }
+          // Mirroring matrices change the winding of the cells, so mirrored meshes are read again
+          if (entry.IsCurves || matrix.determinant() > 0)
+          {
+            if (!entry.Local)
+            {
+              Alembic::Abc::M44d identity;
+              identity.makeIdentity();
+              entry.Local = this->ReadObject(entry, time, identity);
+            }
+            entry.Output = TransformOutput(entry.Local, matrix);
+          }
+          else
+          {
+            entry.Output = this->ReadObject(entry, time, matrix);
+          }
+          break;
+        case ObjectVariance::Deforming:
+          entry.Output = this->ProcessIPolyMesh(
+            Alembic::AbcGeom::IPolyMesh(entry.Object, Alembic::Abc::kWrapExisting), time, matrix,
+            entry.Output);
+          break;
+        case ObjectVariance::TopologyChanging:
+          entry.Output = this->ReadObject(entry, time, matrix);
+          remerge = true;
+          break;
+      }
+      entry.Matrix = matrix;
+
+      remerge = remerge || firstRead || entry.Output->GetNumberOfPoints() != numPoints;
+      updated.push_back(&entry);
+    }
+
+    if (remerge)
+    {
+      vtkNew<vtkAppendPolyData> append;
+      vtkIdType offset = 0;
+      for (ObjectEntry& entry : this->Objects)
+      {
+        append->AddInputData(entry.Output);
+        entry.PointOffset = offset;
+        offset += entry.Output->GetNumberOfPoints();
+      }
+      append->Update();
+      this->Merged = append->GetOutput();
+    }
+    else if (!updated.empty())
+    {
+      // Copy the merged output so previous outputs are not modified, but share its cells and
+      // attributes and only copy the points and normals
+      vtkSmartPointer<vtkPolyData> merged = vtkSmartPointer<vtkPolyData>::New();
+      merged->ShallowCopy(this->Merged);
+
+      vtkNew<vtkPoints> points;
+      points->DeepCopy(this->Merged->GetPoints());
+      vtkSmartPointer<vtkDataArray> normals;
+      if (vtkDataArray* mergedNormals = this->Merged->GetPointData()->GetNormals())
+      {
+        normals = vtk::TakeSmartPointer(mergedNormals->NewInstance());
+        normals->DeepCopy(mergedNormals);
       }
+
+      for (const ObjectEntry* entry : updated)
+      {
+        const vtkIdType numPoints = entry->Output->GetNumberOfPoints();
+        if (numPoints == 0)
+        {
+          continue;
+        }
+        points->GetData()->InsertTuples(
+          entry->PointOffset, numPoints, 0, entry->Output->GetPoints()->GetData());
+        vtkDataArray* entryNormals = entry->Output->GetPointData()->GetNormals();
+        if (normals && entryNormals)
+        {
+          normals->InsertTuples(entry->PointOffset, numPoints, 0, entryNormals);
+        }
+      }
+
+      merged->SetPoints(points);
+      if (normals)
+      {
+        merged->GetPointData()->SetNormals(normals);
+      }
+      this->Merged = merged;
     }
+
+    return this->Merged;
   }
 
   void ExtendTimeRange(double& start, double& end)
@@ -582,9 +829,15 @@ public:
     {
       this->Archive = factory.getArchive(filePath, coreType);
     }
+
+    // Objects are classified again on the next import
+    this->Objects.clear();
+    this->Merged = nullptr;
     return this->Archive.valid();
   }
   Alembic::Abc::IArchive Archive;
+  std::vector<ObjectEntry> Objects;
+  vtkSmartPointer<vtkPolyData> Merged;
 
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251210)
   std::unique_ptr<std::streambuf> Streambuf;
@@ -642,11 +895,7 @@ int vtkF3DAlembicReader::RequestData(
     requestedTimeValue = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
   }
 
-  vtkNew<vtkAppendPolyData> append;
-  this->Internals->ImportRoot(append, requestedTimeValue);
-  append->Update();
-
-  output->ShallowCopy(append->GetOutput());
+  output->ShallowCopy(this->Internals->ImportRoot(requestedTimeValue));
 
   return 1;
 }
@@ -9,6 +9,9 @@
  *
  * This reader supports reading streams.
  *
+ * When animated, only the objects changing over time are read again for each time value,
+ * objects animated only by their transforms are transformed without being read again.
+ *
  * @sa https://github.com/alembic/alembic/blob/master/README.txt
  *
  */
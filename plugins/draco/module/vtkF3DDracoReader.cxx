@@ -1,4 +1,5 @@
 #include "vtkF3DDracoReader.h"
+#include "vtkF3DMappedFileResourceStream.h"
 
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
@@ -8,16 +9,19 @@
 #include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
+#include <vtkMemoryResourceStream.h>
 #include <vtkNew.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
+#include <vtkVersion.h>
 
 #include <draco/compression/decode.h>
 #include <draco/draco_features.h>
-#include <draco/io/stdio_file_reader.h>
 
+#include <algorithm>
 #include <string_view>
 
 #ifndef DRACO_MESH_COMPRESSION_SUPPORTED
@@ -41,16 +45,23 @@ public:
   {
     vtkNew<vtkAOSDataArrayTemplate<T>> arr;
 
-    arr->SetNumberOfComponents(attribute->num_components());
+    const int nbComps = attribute->num_components();
+    arr->SetNumberOfComponents(nbComps);
     arr->SetNumberOfTuples(nbPoints);
 
-    for (int i = 0; i < nbPoints; i++)
-    {
-      draco::AttributeValueIndex idx = attribute->mapped_index(draco::PointIndex(i));
-      T* p = reinterpret_cast<T*>(attribute->buffer()->data() +
-        attribute->byte_stride() * idx.value() + attribute->byte_offset());
-      arr->SetTypedTuple(i, p);
-    }
+    // Values are copied directly from the decoded attribute to the array memory
+    T* values = arr->GetPointer(0);
+    vtkSMPTools::For(0, nbPoints,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          draco::AttributeValueIndex idx =
+            attribute->mapped_index(draco::PointIndex(static_cast<uint32_t>(i)));
+          const T* p = reinterpret_cast<const T*>(attribute->GetAddress(idx));
+          std::copy(p, p + nbComps, values + i * nbComps);
+        }
+      });
 
     return arr;
   }
@@ -146,19 +157,25 @@ public:
     offsets->SetNumberOfTuples(nbCells + 1);
     connectivity->SetNumberOfTuples(3 * nbCells);
 
-    for (int i = 0; i < nbCells; i++)
-    {
-      const draco::Mesh::Face& face = mesh->face(draco::FaceIndex(i));
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+    vtkSMPTools::For(0, nbCells,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          const draco::Mesh::Face& face = mesh->face(draco::FaceIndex(static_cast<uint32_t>(i)));
 
-      offsets->SetTypedComponent(i, 0, 3 * i);
+          offsetsPtr[i] = 3 * i;
 
-      for (int j = 0; j < 3; j++)
-      {
-        connectivity->SetTypedComponent(3 * i + j, 0, face[j].value());
-      }
-    }
+          for (int j = 0; j < 3; j++)
+          {
+            connectivityPtr[3 * i + j] = face[j].value();
+          }
+        }
+      });
 
-    offsets->SetTypedComponent(nbCells, 0, 3 * nbCells);
+    offsetsPtr[nbCells] = 3 * static_cast<vtkIdType>(nbCells);
 
     vtkNew<vtkCellArray> cells;
     cells->SetData(offsets, connectivity);
@@ -188,30 +205,40 @@ int vtkF3DDracoReader::RequestData(
 {
   vtkPolyData* output = vtkPolyData::GetData(outputVector);
 
-  std::vector<char> data;
-
-  if (this->Stream)
-  {
-    this->Stream->Seek(0, vtkResourceStream::SeekDirection::End);
-    size_t length = this->Stream->Tell();
-    this->Stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
-
-    // Read stream into buffer
-    data.resize(length);
-    this->Stream->Read(data.data(), length);
-  }
-  else
+  vtkSmartPointer<vtkResourceStream> stream = this->Stream;
+  if (!stream)
   {
-    auto reader = draco::StdioFileReader::Open(this->FileName);
-    if (!reader || !reader->ReadFileToBuffer(&data))
+    vtkNew<vtkF3DMappedFileResourceStream> fileStream;
+    if (!fileStream->Open(this->FileName.c_str()))
     {
       vtkErrorMacro("Cannot read file");
       return 0;
     }
+    stream = fileStream;
+  }
+
+  stream->Seek(0, vtkResourceStream::SeekDirection::End);
+  size_t length = stream->Tell();
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+
+  // Decode memory streams, such as mapped files, in place and copy other streams
+  const char* data = nullptr;
+  std::vector<char> streamCopy;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  if (auto memStream = vtkMemoryResourceStream::SafeDownCast(stream))
+  {
+    data = static_cast<const char*>(memStream->GetBuffer());
+  }
+#endif
+  if (!data)
+  {
+    streamCopy.resize(length);
+    stream->Read(streamCopy.data(), length);
+    data = streamCopy.data();
   }
 
   draco::DecoderBuffer buffer;
-  buffer.Init(data.data(), data.size());
+  buffer.Init(data, length);
 
   draco::Decoder decoder;
   auto geom_type = draco::Decoder::GetEncodedGeometryType(&buffer);
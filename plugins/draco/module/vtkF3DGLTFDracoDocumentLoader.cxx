@@ -1,8 +1,11 @@
 #include "vtkF3DGLTFDracoDocumentLoader.h"
 
 #include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
 
-#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
 
 #include "draco/compression/decode.h"
 
@@ -17,7 +20,7 @@ std::vector<char> ComponentDispatcher(vtkGLTFDocumentLoader::ComponentType compT
     case vtkGLTFDocumentLoader::ComponentType::BYTE:
       return Decoder().template decode<int8_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::UNSIGNED_BYTE:
-      return Decoder().template decode<uint16_t>(args...);
+      return Decoder().template decode<uint8_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::SHORT:
       return Decoder().template decode<int16_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::UNSIGNED_SHORT:
@@ -34,22 +37,22 @@ std::vector<char> ComponentDispatcher(vtkGLTFDocumentLoader::ComponentType compT
 }
 
 //----------------------------------------------------------------------------
+// Indices and values are written directly in the buffers moved into the model
 struct IndexBufferDecoder
 {
   template<typename T>
   std::vector<char> decode(const std::unique_ptr<draco::Mesh>& mesh)
   {
     std::vector<char> outBuffer(mesh->num_faces() * 3 * sizeof(T));
+    T* indices = reinterpret_cast<T*>(outBuffer.data());
 
     for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f)
     {
       const draco::Mesh::Face& face = mesh->face(f);
-
-      T indices[3] = { static_cast<T>(face[0].value()), static_cast<T>(face[1].value()),
-        static_cast<T>(face[2].value()) };
-
-      std::copy(
-        indices, indices + 3, reinterpret_cast<T*>(outBuffer.data() + f.value() * sizeof(indices)));
+      for (int j = 0; j < 3; j++)
+      {
+        indices[3 * f.value() + j] = static_cast<T>(face[j].value());
+      }
     }
 
     return outBuffer;
@@ -73,18 +76,14 @@ struct VertexBufferDecoder
   std::vector<char> decode(
     const std::unique_ptr<draco::Mesh>& mesh, const draco::PointAttribute* attribute)
   {
-    std::vector<char> outBuffer(mesh->num_points() * attribute->num_components() * sizeof(T));
-    std::vector<T> values(attribute->num_components());
+    const int nbComps = attribute->num_components();
+    std::vector<char> outBuffer(mesh->num_points() * nbComps * sizeof(T));
+    T* values = reinterpret_cast<T*>(outBuffer.data());
 
-    size_t byteOffset = 0;
     for (draco::PointIndex i(0); i < mesh->num_points(); ++i)
     {
       attribute->ConvertValue<T>(
-        attribute->mapped_index(i), attribute->num_components(), values.data());
-
-      std::ranges::copy(values, reinterpret_cast<T*>(outBuffer.data() + byteOffset));
-
-      byteOffset += sizeof(T) * attribute->num_components();
+        attribute->mapped_index(i), static_cast<int8_t>(nbComps), values + i.value() * nbComps);
     }
 
     return outBuffer;
@@ -93,10 +92,79 @@ struct VertexBufferDecoder
 
 //----------------------------------------------------------------------------
 std::vector<char> DecodeVertexBuffer(vtkGLTFDocumentLoader::ComponentType compType,
-  const std::unique_ptr<draco::Mesh>& mesh, int attIndex)
+  const std::unique_ptr<draco::Mesh>& mesh, const draco::PointAttribute* attribute)
+{
+  return ComponentDispatcher<VertexBufferDecoder>(compType, mesh, attribute);
+}
+
+//----------------------------------------------------------------------------
+// Buffers decoded from a Draco compressed primitive, not yet added to the model
+struct DecodedPrimitive
+{
+  vtkGLTFDocumentLoader::Primitive* Primitive = nullptr;
+  bool Decoded = false;
+  int NumberOfIndices = 0;
+  int NumberOfPoints = 0;
+  std::vector<char> IndexBuffer;
+  std::vector<std::pair<int, std::vector<char>>> AttributeBuffers;
+};
+
+//----------------------------------------------------------------------------
+void DecodePrimitive(const vtkGLTFDocumentLoader::Model& model, DecodedPrimitive& decoded)
+{
+  const vtkGLTFDocumentLoader::Primitive& primitive = *decoded.Primitive;
+  const auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
+  const auto& view = model.BufferViews[dracoMetaData.BufferView];
+  const auto& buffer = model.Buffers[view.Buffer];
+
+  draco::DecoderBuffer decoderBuffer;
+  decoderBuffer.Init(buffer.data() + view.ByteOffset, view.ByteLength);
+  auto decodeResult = draco::Decoder().DecodeMeshFromBuffer(&decoderBuffer);
+  if (!decodeResult.ok())
+  {
+    return;
+  }
+
+  const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
+  if (primitive.IndicesId >= 0)
+  {
+    decoded.IndexBuffer =
+      ::DecodeIndexBuffer(mesh, model.Accessors[primitive.IndicesId].ComponentTypeValue);
+    decoded.NumberOfIndices = static_cast<int>(mesh->num_faces() * 3);
+  }
+
+  for (const auto& attrib : dracoMetaData.AttributeIndices)
+  {
+    // Exceptions cannot be thrown from the SMP workers, an attribute missing from the primitive
+    // or from the compressed mesh leaves the primitive not decoded
+    auto attribIt = primitive.AttributeIndices.find(attrib.first);
+    const draco::PointAttribute* dracoAttribute = mesh->GetAttributeByUniqueId(attrib.second);
+    if (attribIt == primitive.AttributeIndices.end() || !dracoAttribute)
+    {
+      return;
+    }
+    const int accessorId = attribIt->second;
+    decoded.AttributeBuffers.emplace_back(accessorId,
+      ::DecodeVertexBuffer(model.Accessors[accessorId].ComponentTypeValue, mesh, dracoAttribute));
+  }
+  decoded.NumberOfPoints = static_cast<int>(mesh->num_points());
+  decoded.Decoded = true;
+}
+
+//----------------------------------------------------------------------------
+int AddBufferView(vtkGLTFDocumentLoader::Model& model, std::vector<char>&& buffer, int target)
 {
-  return ComponentDispatcher<VertexBufferDecoder>(
-    compType, mesh, mesh->GetAttributeByUniqueId(attIndex));
+  model.Buffers.emplace_back(std::move(buffer));
+
+  vtkGLTFDocumentLoader::BufferView decodedBufferView;
+  decodedBufferView.Buffer = static_cast<int>(model.Buffers.size() - 1);
+  decodedBufferView.ByteLength = model.Buffers.back().size();
+  decodedBufferView.ByteOffset = 0;
+  decodedBufferView.ByteStride = 0;
+  decodedBufferView.Target = target;
+  model.BufferViews.emplace_back(std::move(decodedBufferView));
+
+  return static_cast<int>(model.BufferViews.size() - 1);
 }
 }
 
@@ -116,67 +184,56 @@ void vtkF3DGLTFDracoDocumentLoader::PrepareData()
 {
   std::shared_ptr<Model> model = this->GetInternalModel();
 
-  for (size_t i = 0; i < model->Meshes.size(); i++)
+  // check if Draco metadata is present
+  std::vector<::DecodedPrimitive> decodedPrimitives;
+  for (Mesh& mesh : model->Meshes)
   {
-    for (Primitive& primitive : model->Meshes[i].Primitives)
+    for (Primitive& primitive : mesh.Primitives)
     {
-      // check if Draco metadata is present
-      auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
-      if (dracoMetaData.BufferView >= 0)
+      if (primitive.ExtensionMetaData.KHRDracoMetaData.BufferView >= 0)
       {
-        auto& view = model->BufferViews[primitive.ExtensionMetaData.KHRDracoMetaData.BufferView];
-        auto& buffer = model->Buffers[view.Buffer];
-
-        draco::DecoderBuffer decoderBuffer;
-        decoderBuffer.Init(buffer.data() + view.ByteOffset, view.ByteLength);
-        auto decodeResult = draco::Decoder().DecodeMeshFromBuffer(&decoderBuffer);
-        if (decodeResult.ok())
-        {
-          const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
-
-          // handle index buffer
-          if (primitive.IndicesId >= 0)
-          {
-            auto& accessor = model->Accessors[primitive.IndicesId];
-
-            model->Buffers.emplace_back(::DecodeIndexBuffer(mesh, accessor.ComponentTypeValue));
-
-            vtkGLTFDocumentLoader::BufferView decodedIndexBufferView;
-            decodedIndexBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedIndexBufferView.ByteLength = model->Buffers.back().size();
-            decodedIndexBufferView.ByteOffset = 0;
-            decodedIndexBufferView.ByteStride = 0;
-            decodedIndexBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedIndexBufferView));
-
-            accessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            accessor.Count = static_cast<int>(mesh->num_faces() * 3);
-          }
-
-          // handle vertex attributes
-          for (const auto& attrib : dracoMetaData.AttributeIndices)
-          {
-            auto& attrAccessor = model->Accessors[primitive.AttributeIndices[attrib.first]];
-
-            model->Buffers.emplace_back(
-              ::DecodeVertexBuffer(attrAccessor.ComponentTypeValue, mesh, attrib.second));
-
-            vtkGLTFDocumentLoader::BufferView decodedBufferView;
-            decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedBufferView.ByteLength = model->Buffers.back().size();
-            decodedBufferView.ByteOffset = 0;
-            decodedBufferView.ByteStride = 0;
-            decodedBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedBufferView));
-
-            attrAccessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            attrAccessor.Count = static_cast<int>(mesh->num_points());
-            attrAccessor.ByteOffset = 0;
-          }
-        }
+        decodedPrimitives.emplace_back().Primitive = &primitive;
       }
     }
   }
+
+  // Primitives are decoded concurrently as the model is not modified until all are decoded
+  vtkSMPTools::For(0, static_cast<vtkIdType>(decodedPrimitives.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        ::DecodePrimitive(*model, decodedPrimitives[i]);
+      }
+    });
+
+  // Then the buffers are moved in the model, in the order of the primitives
+  for (::DecodedPrimitive& decoded : decodedPrimitives)
+  {
+    if (!decoded.Decoded)
+    {
+      vtkWarningMacro("Could not decode a Draco compressed primitive, ignoring it");
+      continue;
+    }
+
+    // handle index buffer
+    Primitive& primitive = *decoded.Primitive;
+    if (primitive.IndicesId >= 0)
+    {
+      auto& accessor = model->Accessors[primitive.IndicesId];
+      accessor.BufferView = ::AddBufferView(*model, std::move(decoded.IndexBuffer),
+        static_cast<int>(vtkGLTFDocumentLoader::Target::ARRAY_BUFFER));
+      accessor.Count = decoded.NumberOfIndices;
+    }
+
+    // handle vertex attributes
+    for (auto& [accessorId, buffer] : decoded.AttributeBuffers)
+    {
+      auto& attrAccessor = model->Accessors[accessorId];
+      attrAccessor.BufferView = ::AddBufferView(*model, std::move(buffer),
+        static_cast<int>(vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER));
+      attrAccessor.Count = decoded.NumberOfPoints;
+      attrAccessor.ByteOffset = 0;
+    }
+  }
 }
@@ -1,7 +1,46 @@
+bool supportsRequiredArrays() const override
+{
+  return true;
+}
+
 void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream*) const override
 {
   vtkExodusIIReader* exReader = vtkExodusIIReader::SafeDownCast(algo);
   exReader->UpdateInformation();
-  exReader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
-  exReader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+
+  // Only read the requested nodal and element variables if any, as each of them is read
+  // for every time step. Otherwise only read the arrays required by the scene, eg: the coloring
+  // array, if known.
+  std::string optName = "ExodusII.arrays";
+  std::vector<std::string> arrayNames =
+    F3DUtils::ParseToStrings(this->ReaderOptions.at(optName));
+  bool requested = !arrayNames.empty();
+  if (!requested && this->RequiredArrays.has_value())
+  {
+    arrayNames = this->RequiredArrays.value();
+  }
+
+  bool all = !requested && !this->RequiredArrays.has_value();
+
+  int status = all ? 1 : 0;
+  exReader->SetAllArrayStatus(vtkExodusIIReader::NODAL, status);
+  exReader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, status);
+
+  for (const std::string& arrayName : arrayNames)
+  {
+    bool found = false;
+    for (int type : { vtkExodusIIReader::NODAL, vtkExodusIIReader::ELEM_BLOCK })
+    {
+      if (exReader->GetObjectArrayIndex(type, arrayName.c_str()) >= 0)
+      {
+        exReader->SetObjectArrayStatus(type, arrayName.c_str(), 1);
+        found = true;
+      }
+    }
+    if (!found && requested)
+    {
+      vtkWarningWithObjectMacro(nullptr,
+        optName << ": " << arrayName << " is not a nodal or element variable. Ignoring.");
+    }
+  }
 }
@@ -1,15 +1,49 @@
+bool supportsRequiredArrays() const override
+{
+  return true;
+}
+
 void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream*) const override
 {
   vtkNetCDFReader* ncReader = vtkNetCDFReader::SafeDownCast(algo);
   ncReader->UpdateInformation();
-  
+
+  // Only read the requested variables if any, otherwise only read the arrays required by the
+  // scene, eg: the coloring array, if known
+  std::string optName = "NetCDF.arrays";
+  std::vector<std::string> arrayNames =
+    F3DUtils::ParseToStrings(this->ReaderOptions.at(optName));
+  bool requested = !arrayNames.empty();
+  if (!requested && this->RequiredArrays.has_value())
+  {
+    arrayNames = this->RequiredArrays.value();
+  }
+  bool all = !requested && !this->RequiredArrays.has_value();
+
   int numArrays = ncReader->GetNumberOfVariableArrays();
   for (int i = 0; i < numArrays; i++)
   {
     const char* arrayName = ncReader->GetVariableArrayName(i);
     if (arrayName)
     {
-      ncReader->SetVariableArrayStatus(arrayName, 1);
+      bool read = all;
+      for (const std::string& name : arrayNames)
+      {
+        read = read || name == arrayName;
+      }
+      ncReader->SetVariableArrayStatus(arrayName, read ? 1 : 0);
+    }
+  }
+
+  if (requested)
+  {
+    for (const std::string& arrayName : arrayNames)
+    {
+      if (ncReader->GetVariableArrayStatus(arrayName.c_str()) == 0)
+      {
+        vtkWarningWithObjectMacro(
+          nullptr, optName << ": " << arrayName << " is not a variable. Ignoring.");
+      }
     }
   }
 }
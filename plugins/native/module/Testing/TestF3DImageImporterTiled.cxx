@@ -0,0 +1,90 @@
+#include "vtkF3DImageImporter.h"
+#include "vtkF3DTiledImageActor.h"
+
+#include <vtkActorCollection.h>
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkPNGWriter.h>
+#include <vtkPointData.h>
+#include <vtkRenderer.h>
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkActor* ImportImage(vtkF3DImageImporter* importer, const std::string& path, int width, int height)
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(width, height, 1);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 3);
+  image->GetPointData()->GetScalars()->Fill(128);
+
+  vtkNew<vtkPNGWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName(path.c_str());
+  writer->Write();
+
+  importer->SetFileName(path.c_str());
+  importer->SetImageHint("png");
+  if (!importer->Update())
+  {
+    std::cerr << "Unexpected Update failure with " << path << "\n";
+    return nullptr;
+  }
+  return importer->GetRenderer()->GetActors()->GetLastActor();
+}
+
+bool CheckTiled(vtkActor* actor, int expectedNumberOfLevels)
+{
+  vtkF3DTiledImageActor* tiledActor = vtkF3DTiledImageActor::SafeDownCast(actor);
+  if (!tiledActor)
+  {
+    std::cerr << "A large image is not displayed with tiles\n";
+    return false;
+  }
+
+  tiledActor->Wait();
+  if (tiledActor->GetNumberOfLevels() != expectedNumberOfLevels || !tiledActor->ReadTile(2, 0, 0))
+  {
+    std::cerr << "Unexpected pyramid of " << tiledActor->GetNumberOfLevels() << " levels\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DImageImporterTiled(int vtkNotUsed(argc), char* argv[])
+{
+  const std::string tempDir = std::string(argv[2]);
+
+  // Images larger than the maximum texture size along a single dimension are tiled,
+  // even if the other one is smaller than a tile: 9000x16 down to 562x1
+  const int large = vtkF3DImageImporter::MaximumTextureSize + 808;
+  vtkNew<vtkF3DImageImporter> wideImporter;
+  if (!::CheckTiled(
+        ::ImportImage(wideImporter, tempDir + "/TestF3DImageImporterWide.png", large, 16), 5))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkF3DImageImporter> tallImporter;
+  if (!::CheckTiled(
+        ::ImportImage(tallImporter, tempDir + "/TestF3DImageImporterTall.png", 16, large), 5))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Other images are displayed as a single texture
+  vtkNew<vtkF3DImageImporter> smallImporter;
+  vtkActor* actor =
+    ::ImportImage(smallImporter, tempDir + "/TestF3DImageImporterSmall.png", 64, 64);
+  if (!actor || vtkF3DTiledImageActor::SafeDownCast(actor))
+  {
+    std::cerr << "A small image is not displayed as a single texture\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+#include <vtkCallbackCommand.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+
+#include "vtkF3DTiledImageActor.h"
+
+#include <iostream>
+
+int TestF3DTiledImageActor(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // Suppress VTK error output for the invalid image
+  vtkNew<vtkCallbackCommand> nullCallback;
+  nullCallback->SetCallback([](vtkObject*, unsigned long, void*, void*) {});
+
+  vtkNew<vtkF3DTiledImageActor> actor;
+  actor->AddObserver(vtkCommand::ErrorEvent, nullCallback);
+  if (actor->SetImage(nullptr))
+  {
+    std::cerr << "Unexpected SetImage success with no image\n";
+    return EXIT_FAILURE;
+  }
+
+  // Blocks of 2x2 pixels have the same value, so averaged levels are exact
+  auto value = [](int x, int y) { return static_cast<unsigned char>((x / 2 + y / 2) % 200); };
+
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(600, 500, 1);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  for (int y = 0; y < 500; y++)
+  {
+    for (int x = 0; x < 600; x++)
+    {
+      *static_cast<unsigned char*>(image->GetScalarPointer(x, y, 0)) = value(x, y);
+    }
+  }
+
+  actor->SetTileSize(128);
+  if (!actor->SetImage(image))
+  {
+    std::cerr << "Unexpected SetImage failure\n";
+    return EXIT_FAILURE;
+  }
+
+  // 600x500, 300x250, 150x125 and 75x62
+  if (actor->GetNumberOfLevels() != 4)
+  {
+    std::cerr << "Unexpected number of levels: " << actor->GetNumberOfLevels() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkImageData> tile = actor->ReadTile(0, 4, 3);
+  const int* ext = tile ? tile->GetExtent() : nullptr;
+  if (!ext || ext[0] != 512 || ext[1] != 599 || ext[2] != 384 || ext[3] != 499)
+  {
+    std::cerr << "Unexpected extent of the last full resolution tile\n";
+    return EXIT_FAILURE;
+  }
+  if (*static_cast<unsigned char*>(tile->GetScalarPointer(550, 450, 0)) != value(550, 450))
+  {
+    std::cerr << "Unexpected value in the last full resolution tile\n";
+    return EXIT_FAILURE;
+  }
+
+  // The coarsest level is written with the full resolution one
+  if (!actor->ReadTile(3, 0, 0))
+  {
+    std::cerr << "The coarsest level is not available after SetImage\n";
+    return EXIT_FAILURE;
+  }
+
+  // The intermediate levels are built in the background
+  actor->Wait();
+  tile = actor->ReadTile(1, 2, 1);
+  if (!tile || *static_cast<unsigned char*>(tile->GetScalarPointer(280, 200, 0)) != value(560, 400))
+  {
+    std::cerr << "Unexpected value in a reduced tile\n";
+    return EXIT_FAILURE;
+  }
+
+  if (actor->ReadTile(4, 0, 0) || actor->ReadTile(3, 1, 0))
+  {
+    std::cerr << "Unexpected tile outside of the pyramid\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
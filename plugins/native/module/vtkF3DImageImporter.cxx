@@ -1,5 +1,7 @@
 #include "vtkF3DImageImporter.h"
 
+#include "vtkF3DTiledImageActor.h"
+
 #include <vtkCommand.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
@@ -62,6 +64,31 @@ void vtkF3DImageImporter::ImportActors(vtkRenderer* renderer)
   int w = extent[1] - extent[0] + 1;
   int h = extent[3] - extent[2] + 1;
 
+  // HDR and EXR files are expressed in linear color space
+  // All other ones so far are gamma-corrected
+  const bool useSRGB = this->ImageHint != "hdr" && this->ImageHint != "exr";
+
+  // Images too large for a single texture along any dimension are displayed as a pyramid of
+  // tiles stored on disk, the decoded image is released once the tiles are written
+  if (w > vtkF3DImageImporter::MaximumTextureSize || h > vtkF3DImageImporter::MaximumTextureSize)
+  {
+    vtkNew<vtkF3DTiledImageActor> tiledActor;
+    reader->Update();
+    if (!tiledActor->SetImage(reader->GetOutput()))
+    {
+      vtkErrorMacro("Could not build the tiles of the image");
+      this->SetFailureStatus();
+      return;
+    }
+
+    tiledActor->SetUseSRGBColorSpace(useSRGB);
+    tiledActor->GetProperty()->LightingOff();
+    renderer->AddActor(tiledActor);
+
+    this->ActorCollection->AddItem(tiledActor);
+    return;
+  }
+
   vtkNew<vtkTexture> texture;
   texture->SetInputConnection(reader->GetOutputPort());
   texture->SetColorModeToDirectScalars();
@@ -95,12 +122,7 @@ void vtkF3DImageImporter::ImportActors(vtkRenderer* renderer)
   mapper->SetInputData(polydata);
   actor->SetMapper(mapper);
 
-  // HDR and EXR files are expressed in linear color space
-  // All other ones so far are gamma-corrected
-  if (this->ImageHint != "hdr" && this->ImageHint != "exr")
-  {
-    texture->UseSRGBColorSpaceOn();
-  }
+  texture->SetUseSRGBColorSpace(useSRGB);
 
   actor->GetProperty()->LightingOff();
   actor->SetTexture(texture);
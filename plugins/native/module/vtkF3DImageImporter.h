@@ -4,6 +4,7 @@
  *
  * This importer reads 2D image files using vtkImageReader2Factory and displays them as a textured
  * quad sized to the image dimensions. Supports both file-based and stream-based reading.
+ * Images larger than MaximumTextureSize are displayed with a vtkF3DTiledImageActor instead.
  */
 
 #ifndef vtkF3DImageImporter_h
@@ -34,6 +35,12 @@ public:
    */
   vtkSetMacro(ImageHint, std::string);
 
+  /**
+   * Size in pixels above which an image is displayed as a pyramid of tiles
+   * instead of a single texture.
+   */
+  static constexpr int MaximumTextureSize = 8192;
+
 protected:
   vtkF3DImageImporter() = default;
   ~vtkF3DImageImporter() override = default;
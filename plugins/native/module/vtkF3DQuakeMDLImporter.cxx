@@ -1,11 +1,14 @@
 #include "vtkF3DQuakeMDLImporter.h"
+#include "vtkF3DMappedFileResourceStream.h"
 #include "vtkF3DQuakeMDLImporterConstants.h"
+#include "vtkF3DVertexAnimation.h"
 
+#include <vtkActor.h>
 #include <vtkCommand.h>
 #include <vtkDoubleArray.h>
-#include <vtkFileResourceStream.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
+#include <vtkMemoryResourceStream.h>
 #include <vtkOpenGLTexture.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
@@ -13,6 +16,7 @@
 #include <vtkProperty.h>
 #include <vtkRenderer.h>
 #include <vtkResourceStream.h>
+#include <vtkVersion.h>
 
 #include <cstdint>
 #include <cstring>
@@ -112,10 +116,28 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
     }
   };
 
+  //----------------------------------------------------------------------------
+  // Non-owning view of the parsed bytes, so memory streams can be parsed without a copy
+  struct buffer_view_t
+  {
+    const uint8_t* Data;
+    size_t Size;
+
+    const uint8_t* data() const
+    {
+      return this->Data;
+    }
+
+    size_t size() const
+    {
+      return this->Size;
+    }
+  };
+
   //----------------------------------------------------------------------------
   // Safer buffer typecasting of arbitrary buffer location
   template<typename TYPE>
-  static const TYPE* PeekFromVector(const std::vector<uint8_t>& buffer, const size_t& offset)
+  static const TYPE* PeekFromVector(const buffer_view_t& buffer, const size_t& offset)
   {
     static_assert(std::is_standard_layout_v<TYPE>, "Vector typecast requires POD input");
 
@@ -130,7 +152,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   //----------------------------------------------------------------------------
   // Safer buffer typecasting with auto offset incrementing
   template<typename TYPE>
-  static const TYPE* ReadFromVector(const std::vector<uint8_t>& buffer, size_t& offset)
+  static const TYPE* ReadFromVector(const buffer_view_t& buffer, size_t& offset)
   {
     const TYPE* ptr = vtkInternals::PeekFromVector<TYPE>(buffer, offset);
     offset += sizeof(TYPE);
@@ -140,7 +162,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   //----------------------------------------------------------------------------
   // Safer buffer typecasting of arbitrary buffer location with variable length data
   static const mdl_simpleframe_t* PeekFromVectorSimpleframe(
-    const std::vector<uint8_t>& buffer, const size_t& offset, size_t num_verts = 0)
+    const buffer_view_t& buffer, const size_t& offset, size_t num_verts = 0)
   {
     static constexpr auto mdl_simpleframe_t_fixed_size =
       sizeof(mdl_simpleframe_t) - sizeof(mdl_simpleframe_t::verts);
@@ -158,7 +180,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   }
 
   //----------------------------------------------------------------------------
-  static bool ReadAndCheckHeader(const std::vector<uint8_t>& buffer, vtkObject* object,
+  static bool ReadAndCheckHeader(const buffer_view_t& buffer, vtkObject* object,
     size_t& offset, const mdl_header_t*& header)
   {
     // Read header
@@ -200,7 +222,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   //----------------------------------------------------------------------------
   // Safer buffer typecasting with auto offset incrementing with variable length data
   static const mdl_simpleframe_t* ReadFromVectorSimpleframe(
-    const std::vector<uint8_t>& buffer, size_t& offset, size_t num_verts = 0)
+    const buffer_view_t& buffer, size_t& offset, size_t num_verts = 0)
   {
     static constexpr auto mdl_simpleframe_t_fixed_size =
       sizeof(mdl_simpleframe_t) - sizeof(mdl_simpleframe_t::verts);
@@ -216,7 +238,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   }
 
   //----------------------------------------------------------------------------
-  vtkSmartPointer<vtkTexture> CreateTexture(const std::vector<uint8_t>& buffer, size_t& offset,
+  vtkSmartPointer<vtkTexture> CreateTexture(const buffer_view_t& buffer, size_t& offset,
     int skinWidth, int skinHeight, unsigned int nbSkins, unsigned int skinIndex)
   {
     auto make_new_skin = [&](vtkNew<vtkImageData>& skin)
@@ -309,9 +331,10 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
   }
 
   //----------------------------------------------------------------------------
-  vtkSmartPointer<vtkPolyData> CreateMeshForSimpleFrame(const mdl_simpleframe_t* frame,
-    const mdl_header_t* header, const mdl_triangle_t* triangles, vtkCellArray* cells,
-    vtkFloatArray* textureCoordinates)
+  // The first frame creates the animated mesh, the others are added as keyframes of it
+  // Return the index of the keyframe
+  int CreateKeyframe(const mdl_simpleframe_t* frame, const mdl_header_t* header,
+    const mdl_triangle_t* triangles, vtkCellArray* cells, vtkFloatArray* textureCoordinates)
   {
     vtkNew<vtkPoints> vertices;
 
@@ -348,16 +371,23 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
         normals->SetTypedTuple(i * 3 + j, F3DMDLNormalVectors[normalIndex]);
       }
     }
+    if (this->VertexAnimation->GetNumberOfKeyframes() > 0)
+    {
+      return this->VertexAnimation->AddKeyframe(vertices->GetData(), normals);
+    }
+
     vtkNew<vtkPolyData> mesh;
     mesh->SetPoints(vertices);
     mesh->SetPolys(cells);
     mesh->GetPointData()->SetTCoords(textureCoordinates);
     mesh->GetPointData()->SetNormals(normals);
-    return mesh;
+    this->VertexAnimation->SetMesh(mesh);
+    this->Mesh = mesh;
+    return 0;
   }
 
   //----------------------------------------------------------------------------
-  bool CreateMesh(const std::vector<uint8_t>& buffer, size_t offset, const mdl_header_t* header)
+  bool CreateMesh(const buffer_view_t& buffer, size_t offset, const mdl_header_t* header)
   {
     try
     {
@@ -510,7 +540,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
       {
         this->AnimationNames.emplace_back(animName);
         this->AnimationTimes.emplace_back(std::vector<double>());
-        this->AnimationFrames.emplace_back(std::vector<vtkSmartPointer<vtkPolyData>>());
+        this->AnimationKeyframes.emplace_back(std::vector<int>());
         return this->AnimationNames.size() - 1;
       };
 
@@ -544,16 +574,15 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
           times.emplace_back(times.back() + 0.1);
 
           // Create the animation frame
-          vtkSmartPointer<vtkPolyData> mesh =
-            this->CreateMeshForSimpleFrame(frame, header, triangles, cells, textureCoordinates);
-          this->AnimationFrames[singleFrameAnimIdx].emplace_back(mesh);
+          this->AnimationKeyframes[singleFrameAnimIdx].emplace_back(
+            this->CreateKeyframe(frame, header, triangles, cells, textureCoordinates));
         }
         else
         {
           // Group frame are expected to be a single animation
           std::string animationName;
           std::vector<double> times;
-          std::vector<vtkSmartPointer<vtkPolyData>> meshes;
+          std::vector<int> keyframes;
 
           // groupFrames always start at 0.0
           times.emplace_back(0.0);
@@ -575,13 +604,13 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
             // Recover time for this frame from the dedicated table
             times.emplace_back(pluginFramePtr.time[groupFrameNum]);
 
-            // Recover mesh for this frame
-            meshes.emplace_back(
-              this->CreateMeshForSimpleFrame(frame, header, triangles, cells, textureCoordinates));
+            // Recover keyframe for this frame
+            keyframes.emplace_back(
+              this->CreateKeyframe(frame, header, triangles, cells, textureCoordinates));
           }
           this->AnimationNames.emplace_back(animationName);
           this->AnimationTimes.emplace_back(times);
-          this->AnimationFrames.emplace_back(meshes);
+          this->AnimationKeyframes.emplace_back(keyframes);
         }
 
         currentProgress++;
@@ -613,10 +642,21 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
     size_t length = stream->Tell();
     stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
 
-    // Read stream into buffer
-    // TODO rework to avoid copying the whole buffer
-    std::vector<uint8_t> buffer(length);
-    stream->Read(buffer.data(), length);
+    // Parse memory streams, such as mapped files, in place and copy other streams
+    buffer_view_t buffer{ nullptr, length };
+    std::vector<uint8_t> streamCopy;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+    if (auto memStream = vtkMemoryResourceStream::SafeDownCast(stream))
+    {
+      buffer.Data = static_cast<const uint8_t*>(memStream->GetBuffer());
+    }
+#endif
+    if (!buffer.Data)
+    {
+      streamCopy.resize(length);
+      stream->Read(streamCopy.data(), length);
+      buffer.Data = streamCopy.data();
+    }
 
     // Read Header
     size_t offset = 0;
@@ -640,7 +680,7 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
 
     // Create animation frames
     bool ret = this->CreateMesh(buffer, offset, header);
-    if (this->AnimationFrames.empty() || this->AnimationFrames.front().empty())
+    if (this->AnimationKeyframes.empty() || this->AnimationKeyframes.front().empty())
     {
       vtkErrorWithObjectMacro(
         this->Parent, "No frame read, there is nothing to display in this file.");
@@ -651,12 +691,15 @@ struct vtkF3DQuakeMDLImporter::vtkInternals
 
   //----------------------------------------------------------------------------
   vtkF3DQuakeMDLImporter* Parent;
-  vtkSmartPointer<vtkPolyDataMapper> Mapper;
+  vtkSmartPointer<vtkActor> Actor;
   vtkSmartPointer<vtkTexture> Texture;
 
+  // All the frames are keyframes of a single mesh, interpolated on the GPU
+  vtkSmartPointer<vtkPolyData> Mesh;
+  vtkNew<vtkF3DVertexAnimation> VertexAnimation;
   std::vector<std::string> AnimationNames;
   std::vector<std::vector<double>> AnimationTimes;
-  std::vector<std::vector<vtkSmartPointer<vtkPolyData>>> AnimationFrames;
+  std::vector<std::vector<int>> AnimationKeyframes;
 
   std::vector<std::string> GroupSkinAnimationNames;
   std::vector<std::vector<vtkSmartPointer<vtkImageData>>> GroupSkins;
@@ -676,7 +719,7 @@ int vtkF3DQuakeMDLImporter::ImportBegin()
 {
   // Stream is higher priority than filename.
   vtkResourceStream* stream = this->GetStream();
-  vtkNew<vtkFileResourceStream> fileStream;
+  vtkNew<vtkF3DMappedFileResourceStream> fileStream;
   if (!stream)
   {
     if (!fileStream->Open(this->GetFileName()))
@@ -696,13 +739,15 @@ void vtkF3DQuakeMDLImporter::ImportActors(vtkRenderer* renderer)
 {
   vtkNew<vtkActor> actor;
   vtkNew<vtkPolyDataMapper> mapper;
-  mapper->SetInputData(this->Internals->AnimationFrames[0][0]);
+  mapper->SetInputData(this->Internals->Mesh);
   actor->SetMapper(mapper);
   actor->GetProperty()->SetInterpolationToPBR();
   actor->GetProperty()->SetBaseColorTexture(this->Internals->Texture);
   actor->GetProperty()->SetBaseIOR(1.0);
+  const int firstKeyframe = this->Internals->AnimationKeyframes[0][0];
+  this->Internals->VertexAnimation->InterpolateKeyframes(actor, firstKeyframe, firstKeyframe, 0.0);
   renderer->AddActor(actor);
-  this->Internals->Mapper = mapper;
+  this->Internals->Actor = actor;
   this->ActorCollection->AddItem(actor);
 }
 
@@ -717,7 +762,7 @@ bool vtkF3DQuakeMDLImporter::UpdateAtTimeValue(double timeValue)
     // First time >= value, excluding the last element as it only represents finish time of the last
     // frame
 
-    // Animation in AnimationFrames are mesh animations and at greater indices texture animations
+    // Animation in AnimationKeyframes are mesh animations and at greater indices texture animations
     // are rendered
     bool isMeshAnimation = this->Internals->ActiveAnimation <
       static_cast<vtkIdType>(this->Internals->AnimationNames.size());
@@ -736,8 +781,18 @@ bool vtkF3DQuakeMDLImporter::UpdateAtTimeValue(double timeValue)
     const size_t frameIndex = times[i] > timeValue && i > 0 ? i - 1 : i;
     if (isMeshAnimation)
     {
-      this->Internals->Mapper->SetInputData(
-        this->Internals->AnimationFrames[animIndex][frameIndex]);
+      // Interpolate toward the next frame if any, the last frame is held until the end
+      const std::vector<int>& keyframes = this->Internals->AnimationKeyframes[animIndex];
+      size_t nextFrameIndex = frameIndex;
+      double factor = 0.0;
+      if (this->InterpolateFrames && frameIndex + 1 < keyframes.size() &&
+        times[frameIndex + 1] > times[frameIndex])
+      {
+        nextFrameIndex = frameIndex + 1;
+        factor = (timeValue - times[frameIndex]) / (times[frameIndex + 1] - times[frameIndex]);
+      }
+      this->Internals->VertexAnimation->InterpolateKeyframes(this->Internals->Actor,
+        keyframes[frameIndex], keyframes[nextFrameIndex], factor);
     }
     else
     {
@@ -841,7 +896,7 @@ bool vtkF3DQuakeMDLImporter::CanReadFile(vtkResourceStream* stream)
   // Check header buffer
   size_t offset = 0;
   const vtkInternals::mdl_header_t* header;
-  if (!vtkInternals::ReadAndCheckHeader(buffer, nullptr, offset, header))
+  if (!vtkInternals::ReadAndCheckHeader({ buffer.data(), buffer.size() }, nullptr, offset, header))
   {
     return false;
   }
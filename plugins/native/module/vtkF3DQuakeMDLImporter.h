@@ -5,6 +5,8 @@
  * This reader is based on implementations of Quake 1's MDL, defined in
  * https://book.leveldesignbook.com/appendix/resources/formats/mdl It reads vertices, normals and
  * texture coordinate data from .mdl files. Supports animations.
+ * The frames of the animations are stored once as keyframes of a single mesh, see
+ * vtkF3DVertexAnimation, and can be interpolated to play smoothly.
  *
  * This reader expects a header "ident" value of either 0x4F504449 ("IDPO") or 0x54534449 ("IDST")
  * This reader expects a header "version" value of exactly 6
@@ -70,6 +72,17 @@ public:
   vtkGetMacro(SkinIndex, unsigned int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get if mesh animations are interpolated between frames instead of displaying each
+   * frame for its whole duration.
+   * Default is true.
+   */
+  vtkSetMacro(InterpolateFrames, bool);
+  vtkGetMacro(InterpolateFrames, bool);
+  vtkBooleanMacro(InterpolateFrames, bool);
+  ///@}
+
   /**
    * Return true if, after a quick check of file header, it looks like the provided stream
    * can be read. Return false if it is sure it cannot be read as a strean.
@@ -92,6 +105,7 @@ private:
 
   struct vtkInternals;
   unsigned int SkinIndex = 0;
+  bool InterpolateFrames = true;
 
   std::unique_ptr<vtkInternals> Internals;
 };
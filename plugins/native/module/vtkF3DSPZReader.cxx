@@ -1,9 +1,10 @@
 #include "vtkF3DSPZReader.h"
+#include "vtkF3DMappedFileResourceStream.h"
 
-#include <vtkFileResourceStream.h>
 #include <vtkFloatArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
+#include <vtkMemoryResourceStream.h>
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
@@ -16,14 +17,14 @@
 namespace
 {
 //----------------------------------------------------------------------------
-bool UncompressGzip(
-  const std::vector<unsigned char>& compressed, std::vector<unsigned char>& uncompressed)
+bool UncompressGzip(const unsigned char* compressed, size_t compressedLength,
+  std::vector<unsigned char>& uncompressed)
 {
   std::vector<uint8_t> buffer(8192);
 
   z_stream stream = {};
-  stream.next_in = const_cast<Bytef*>(compressed.data());
-  stream.avail_in = static_cast<unsigned int>(compressed.size());
+  stream.next_in = const_cast<Bytef*>(compressed);
+  stream.avail_in = static_cast<unsigned int>(compressedLength);
 
   inflateInit2(&stream, 16 | MAX_WBITS);
 
@@ -292,7 +293,7 @@ int vtkF3DSPZReader::RequestData(
   else
 #endif
   {
-    vtkNew<vtkFileResourceStream> fileStream;
+    vtkNew<vtkF3DMappedFileResourceStream> fileStream;
     fileStream->Open(this->FileName);
     stream = fileStream;
   }
@@ -302,9 +303,21 @@ int vtkF3DSPZReader::RequestData(
 
   stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
 
-  std::vector<unsigned char> compressed(compressedLength);
-
-  stream->Read(compressed.data(), compressedLength);
+  // Uncompress memory streams, such as mapped files, in place and copy other streams
+  const unsigned char* compressed = nullptr;
+  std::vector<unsigned char> streamCopy;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  if (auto memStream = vtkMemoryResourceStream::SafeDownCast(stream))
+  {
+    compressed = static_cast<const unsigned char*>(memStream->GetBuffer());
+  }
+#endif
+  if (!compressed)
+  {
+    streamCopy.resize(compressedLength);
+    stream->Read(streamCopy.data(), compressedLength);
+    compressed = streamCopy.data();
+  }
 
   // get the buffer size in order to pre-allocate
   uint32_t uncompressedLength = static_cast<uint32_t>(compressed[compressedLength - 4]) |
@@ -315,7 +328,7 @@ int vtkF3DSPZReader::RequestData(
   std::vector<unsigned char> uncompressed;
   uncompressed.reserve(uncompressedLength);
 
-  if (!::UncompressGzip(compressed, uncompressed))
+  if (!::UncompressGzip(compressed, compressedLength, uncompressed))
   {
     vtkErrorMacro("Invalid GZIP file");
     return 0;
@@ -1,10 +1,10 @@
 #include "vtkF3DSplatReader.h"
+#include "vtkF3DMappedFileResourceStream.h"
 
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkCommand.h>
 #include <vtkDemandDrivenPipeline.h>
-#include <vtkFileResourceStream.h>
 #include <vtkFloatArray.h>
 #include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
@@ -56,7 +56,7 @@ int vtkF3DSplatReader::RequestData(
   else
 #endif
   {
-    vtkNew<vtkFileResourceStream> fileStream;
+    vtkNew<vtkF3DMappedFileResourceStream> fileStream;
     fileStream->Open(this->FileName);
     stream = fileStream;
   }
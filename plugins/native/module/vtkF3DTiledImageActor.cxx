@@ -0,0 +1,748 @@
+#include "vtkF3DTiledImageActor.h"
+
+#include <vtkCamera.h>
+#include <vtkDataArray.h>
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkImageShrink3D.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkTexture.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Create a quad covering the provided rectangle of the z=0 plane, with texture coordinates
+vtkSmartPointer<vtkPolyData> CreateQuad(double x0, double y0, double x1, double y1)
+{
+  vtkSmartPointer<vtkPolyData> polydata = vtkSmartPointer<vtkPolyData>::New();
+  polydata->Allocate(1);
+  vtkIdType pts[4] = { 0, 1, 2, 3 };
+  polydata->InsertNextCell(VTK_QUAD, 4, pts);
+
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(4);
+  points->SetPoint(0, x0, y0, 0.0);
+  points->SetPoint(1, x1, y0, 0.0);
+  points->SetPoint(2, x1, y1, 0.0);
+  points->SetPoint(3, x0, y1, 0.0);
+  polydata->SetPoints(points);
+
+  vtkNew<vtkFloatArray> tcoords;
+  tcoords->SetNumberOfComponents(2);
+  tcoords->SetNumberOfTuples(4);
+  tcoords->SetTuple2(0, 0.0, 0.0);
+  tcoords->SetTuple2(1, 1.0, 0.0);
+  tcoords->SetTuple2(2, 1.0, 1.0);
+  tcoords->SetTuple2(3, 0.0, 1.0);
+  polydata->GetPointData()->SetTCoords(tcoords);
+  return polydata;
+}
+}
+
+//----------------------------------------------------------------------------
+class vtkF3DTiledImageActor::vtkInternals
+{
+public:
+  struct Level
+  {
+    std::array<int, 2> Dimensions;
+    std::array<int, 2> NumberOfTiles;
+  };
+
+  struct Tile
+  {
+    vtkSmartPointer<vtkActor> Actor;
+    vtkTypeInt64 Size = 0;
+    std::uint64_t LastFrame = 0;
+  };
+
+  using TileKey = std::array<int, 3>;
+
+  ~vtkInternals()
+  {
+    this->StopBuild();
+    this->RemoveTileDirectory();
+  }
+
+  //----------------------------------------------------------------------------
+  // Stop building the intermediate levels in the background
+  void StopBuild()
+  {
+    this->Abort = true;
+    if (this->Future.valid())
+    {
+      this->Future.wait();
+      this->Future = std::future<bool>();
+    }
+    this->Abort = false;
+  }
+
+  //----------------------------------------------------------------------------
+  // Check if the tiles of a level are written, the intermediate levels being built in order
+  bool IsLevelBuilt(int level) const
+  {
+    return level == static_cast<int>(this->Levels.size()) - 1 || level < this->BuiltLevels;
+  }
+
+  //----------------------------------------------------------------------------
+  void RemoveTileDirectory()
+  {
+    if (!this->Directory.empty())
+    {
+      std::error_code ec;
+      fs::remove_all(this->Directory, ec);
+      this->Directory.clear();
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  bool CreateTileDirectory()
+  {
+    std::error_code ec;
+    const fs::path temp = fs::temp_directory_path(ec);
+    if (ec)
+    {
+      return false;
+    }
+
+    std::random_device random;
+    for (int attempt = 0; attempt < 16; attempt++)
+    {
+      fs::path directory = temp / ("f3d_tiles_" + std::to_string(random()));
+      if (fs::create_directory(directory, ec))
+      {
+        this->Directory = directory;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //----------------------------------------------------------------------------
+  fs::path GetTilePath(int level, int x, int y) const
+  {
+    return this->Directory /
+      (std::to_string(level) + "_" + std::to_string(x) + "_" + std::to_string(y) + ".raw");
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the extent of a tile in the pixels of its level, return false if it does not exist
+  bool GetTileExtent(int level, int x, int y, int extent[6]) const
+  {
+    if (level < 0 || level >= static_cast<int>(this->Levels.size()))
+    {
+      return false;
+    }
+    const Level& lvl = this->Levels[level];
+    if (x < 0 || y < 0 || x >= lvl.NumberOfTiles[0] || y >= lvl.NumberOfTiles[1])
+    {
+      return false;
+    }
+    extent[0] = x * this->TileSize;
+    extent[1] = std::min((x + 1) * this->TileSize, lvl.Dimensions[0]) - 1;
+    extent[2] = y * this->TileSize;
+    extent[3] = std::min((y + 1) * this->TileSize, lvl.Dimensions[1]) - 1;
+    extent[4] = 0;
+    extent[5] = 0;
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  bool WriteTile(int level, int x, int y, vtkImageData* image) const
+  {
+    vtkDataArray* scalars = image->GetPointData()->GetScalars();
+    std::ofstream file(this->GetTilePath(level, x, y), std::ios::binary);
+    file.write(static_cast<const char*>(scalars->GetVoidPointer(0)),
+      static_cast<std::streamsize>(scalars->GetNumberOfValues()) * scalars->GetDataTypeSize());
+    return static_cast<bool>(file);
+  }
+
+  //----------------------------------------------------------------------------
+  // Split an image with the dimensions of a level in tiles and write them
+  bool WriteTiles(int level, vtkImageData* image) const
+  {
+    const Level& lvl = this->Levels[level];
+    const int* imageExt = image->GetExtent();
+    if (imageExt[1] - imageExt[0] + 1 < lvl.Dimensions[0] ||
+      imageExt[3] - imageExt[2] + 1 < lvl.Dimensions[1])
+    {
+      return false;
+    }
+
+    for (int y = 0; y < lvl.NumberOfTiles[1]; y++)
+    {
+      for (int x = 0; x < lvl.NumberOfTiles[0]; x++)
+      {
+        int ext[6];
+        this->GetTileExtent(level, x, y, ext);
+
+        int sourceExt[6] = { imageExt[0] + ext[0], imageExt[0] + ext[1], imageExt[2] + ext[2],
+          imageExt[2] + ext[3], imageExt[4], imageExt[4] };
+        vtkNew<vtkImageData> tile;
+        tile->SetExtent(sourceExt);
+        tile->AllocateScalars(this->ScalarType, this->NumberOfComponents);
+        tile->CopyAndCastFrom(image, sourceExt);
+        if (!this->WriteTile(level, x, y, tile))
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Read a tile from the disk without checking that its level is built
+  vtkSmartPointer<vtkImageData> ReadTile(int level, int x, int y) const
+  {
+    int ext[6];
+    if (!this->GetTileExtent(level, x, y, ext))
+    {
+      return nullptr;
+    }
+
+    vtkSmartPointer<vtkImageData> tile = vtkSmartPointer<vtkImageData>::New();
+    tile->SetExtent(ext);
+    tile->AllocateScalars(this->ScalarType, this->NumberOfComponents);
+
+    vtkDataArray* scalars = tile->GetPointData()->GetScalars();
+    std::ifstream file(this->GetTilePath(level, x, y), std::ios::binary);
+    file.read(static_cast<char*>(scalars->GetVoidPointer(0)),
+      static_cast<std::streamsize>(scalars->GetNumberOfValues()) * scalars->GetDataTypeSize());
+    if (!file)
+    {
+      return nullptr;
+    }
+    return tile;
+  }
+
+  //----------------------------------------------------------------------------
+  // Build a tile from the four tiles of the previous level covering it
+  bool BuildTile(int level, int x, int y) const
+  {
+    int childrenExtent[6] = { VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN, 0, 0 };
+    std::vector<vtkSmartPointer<vtkImageData>> children;
+    for (int cy = 2 * y; cy <= 2 * y + 1; cy++)
+    {
+      for (int cx = 2 * x; cx <= 2 * x + 1; cx++)
+      {
+        vtkSmartPointer<vtkImageData> child = this->ReadTile(level - 1, cx, cy);
+        if (child)
+        {
+          const int* ext = child->GetExtent();
+          childrenExtent[0] = std::min(childrenExtent[0], ext[0]);
+          childrenExtent[1] = std::max(childrenExtent[1], ext[1]);
+          childrenExtent[2] = std::min(childrenExtent[2], ext[2]);
+          childrenExtent[3] = std::max(childrenExtent[3], ext[3]);
+          children.emplace_back(child);
+        }
+      }
+    }
+    if (children.empty())
+    {
+      return false;
+    }
+
+    vtkNew<vtkImageData> assembled;
+    assembled->SetExtent(childrenExtent);
+    assembled->AllocateScalars(this->ScalarType, this->NumberOfComponents);
+    for (vtkImageData* child : children)
+    {
+      assembled->CopyAndCastFrom(child, child->GetExtent());
+    }
+
+    // Average blocks of 2x2 pixels, the output extent is the extent of the tile
+    vtkNew<vtkImageShrink3D> shrink;
+    shrink->SetInputData(assembled);
+    shrink->SetShrinkFactors(2, 2, 1);
+    shrink->AveragingOn();
+    shrink->Update();
+    return this->WriteTile(level, x, y, shrink->GetOutput());
+  }
+
+  //----------------------------------------------------------------------------
+  // Build the intermediate levels from the previous one, so only a few tiles are in memory.
+  // Run in a background thread.
+  bool BuildLevels()
+  {
+    const int coarsest = static_cast<int>(this->Levels.size()) - 1;
+    for (int level = 1; level < coarsest; level++)
+    {
+      const Level& lvl = this->Levels[level];
+      for (int y = 0; y < lvl.NumberOfTiles[1]; y++)
+      {
+        for (int x = 0; x < lvl.NumberOfTiles[0]; x++)
+        {
+          if (this->Abort || !this->BuildTile(level, x, y))
+          {
+            return false;
+          }
+        }
+      }
+      this->BuiltLevels = level + 1;
+    }
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Report the end of the background build
+  void Poll(vtkF3DTiledImageActor* self)
+  {
+    using namespace std::chrono_literals;
+    if (!this->Future.valid() || this->Future.wait_for(0s) != std::future_status::ready)
+    {
+      return;
+    }
+
+    if (!this->Future.get())
+    {
+      vtkWarningWithObjectMacro(self, "Could not build the intermediate levels in "
+          << this->Directory.string() << ", only the coarsest one is displayed");
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Get the actor of a tile, reading it if not cached
+  vtkActor* GetTileActor(vtkF3DTiledImageActor* self, int level, int x, int y)
+  {
+    auto [it, inserted] = this->Tiles.try_emplace(TileKey{ level, x, y });
+    Tile& tile = it->second;
+    if (inserted)
+    {
+      vtkSmartPointer<vtkImageData> image = self->ReadTile(level, x, y);
+      if (!image)
+      {
+        this->Tiles.erase(it);
+        return nullptr;
+      }
+
+      // A pixel of a level covers 2^level pixels of the image along each axis
+      const int* ext = image->GetExtent();
+      const double scale = static_cast<double>(1 << level);
+
+      vtkNew<vtkTexture> texture;
+      texture->SetInputData(image);
+      texture->SetColorModeToDirectScalars();
+      texture->SetUseSRGBColorSpace(self->UseSRGBColorSpace);
+
+      vtkNew<vtkPolyDataMapper> mapper;
+      mapper->SetInputData(
+        ::CreateQuad(ext[0] * scale, ext[2] * scale, (ext[1] + 1) * scale, (ext[3] + 1) * scale));
+
+      tile.Actor = vtkSmartPointer<vtkActor>::New();
+      tile.Actor->SetMapper(mapper);
+      tile.Actor->SetTexture(texture);
+      tile.Actor->SetUserMatrix(self->GetMatrix());
+      tile.Size = image->GetActualMemorySize() * 1024;
+      this->CachedSize += tile.Size;
+    }
+    tile.LastFrame = this->Frame;
+    tile.Actor->SetProperty(self->GetProperty());
+    return tile.Actor;
+  }
+
+  //----------------------------------------------------------------------------
+  // Select the tiles to render from the camera of the renderer
+  void SelectTiles(vtkF3DTiledImageActor* self, vtkRenderer* ren)
+  {
+    this->Frame++;
+    this->Visible.clear();
+    if (this->Levels.empty())
+    {
+      return;
+    }
+    this->Poll(self);
+
+    vtkCamera* camera = ren->GetActiveCamera();
+    double planes[24];
+    camera->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+    const double height = ren->GetSize()[1];
+    vtkMatrix4x4* matrix = self->GetMatrix();
+
+    std::vector<TileKey> stack;
+    const int coarsest = static_cast<int>(this->Levels.size()) - 1;
+    for (int y = 0; y < this->Levels[coarsest].NumberOfTiles[1]; y++)
+    {
+      for (int x = 0; x < this->Levels[coarsest].NumberOfTiles[0]; x++)
+      {
+        stack.push_back({ coarsest, x, y });
+      }
+    }
+
+    while (!stack.empty())
+    {
+      const auto [level, x, y] = stack.back();
+      stack.pop_back();
+
+      int ext[6];
+      this->GetTileExtent(level, x, y, ext);
+      const double scale = static_cast<double>(1 << level);
+      const double x0 = ext[0] * scale;
+      const double x1 = (ext[1] + 1) * scale;
+      const double y0 = ext[2] * scale;
+      const double y1 = (ext[3] + 1) * scale;
+
+      std::array<std::array<double, 4>, 4> corners = { { { x0, y0, 0.0, 1.0 },
+        { x1, y0, 0.0, 1.0 }, { x1, y1, 0.0, 1.0 }, { x0, y1, 0.0, 1.0 } } };
+      for (auto& corner : corners)
+      {
+        matrix->MultiplyPoint(corner.data(), corner.data());
+      }
+
+      // Skip the tile if all its corners are outside of a plane of the frustum
+      bool culled = false;
+      for (int p = 0; p < 6 && !culled; p++)
+      {
+        const double* plane = planes + 4 * p;
+        culled = std::all_of(corners.begin(), corners.end(),
+          [&](const auto& c)
+          { return plane[0] * c[0] + plane[1] * c[1] + plane[2] * c[2] + plane[3] < 0.0; });
+      }
+      if (culled)
+      {
+        continue;
+      }
+
+      // While the intermediate levels are built, the tile is displayed without refinement and
+      // will be refined in a later render
+      if (level > 0 && this->IsLevelBuilt(level - 1) &&
+        this->NeedsRefinement(camera, height, corners, ext))
+      {
+        for (int cy = 2 * y; cy <= 2 * y + 1; cy++)
+        {
+          for (int cx = 2 * x; cx <= 2 * x + 1; cx++)
+          {
+            int childExt[6];
+            if (this->GetTileExtent(level - 1, cx, cy, childExt))
+            {
+              stack.push_back({ level - 1, cx, cy });
+            }
+          }
+        }
+        continue;
+      }
+
+      vtkActor* actor = this->GetTileActor(self, level, x, y);
+      if (actor)
+      {
+        this->Visible.push_back(actor);
+      }
+    }
+
+    this->ReleaseTiles(ren->GetRenderWindow());
+  }
+
+  //----------------------------------------------------------------------------
+  // Check if a pixel of the tile covers more than one pixel on screen
+  bool NeedsRefinement(vtkCamera* camera, double height,
+    const std::array<std::array<double, 4>, 4>& corners, const int ext[6]) const
+  {
+    const double pixelSize =
+      std::sqrt(vtkMath::Distance2BetweenPoints(corners[0].data(), corners[1].data())) /
+      (ext[1] - ext[0] + 1);
+
+    double pixelsPerUnit;
+    if (camera->GetParallelProjection())
+    {
+      pixelsPerUnit = height / (2.0 * camera->GetParallelScale());
+    }
+    else
+    {
+      double center[3];
+      for (int i = 0; i < 3; i++)
+      {
+        center[i] = (corners[0][i] + corners[2][i]) / 2.0;
+      }
+      const double radius =
+        std::sqrt(vtkMath::Distance2BetweenPoints(corners[0].data(), corners[2].data())) / 2.0;
+      const double distance =
+        std::sqrt(vtkMath::Distance2BetweenPoints(center, camera->GetPosition()));
+      if (distance <= radius)
+      {
+        // The camera is close to the tile
+        return true;
+      }
+      pixelsPerUnit = height /
+        (2.0 * distance * std::tan(vtkMath::RadiansFromDegrees(camera->GetViewAngle()) / 2.0));
+    }
+    return pixelSize * pixelsPerUnit > 1.0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Release the least recently rendered tiles until the cache fits in the memory budget
+  void ReleaseTiles(vtkWindow* window)
+  {
+    if (this->CachedSize <= this->MemoryBudget)
+    {
+      return;
+    }
+
+    std::vector<std::map<TileKey, Tile>::iterator> candidates;
+    for (auto it = this->Tiles.begin(); it != this->Tiles.end(); ++it)
+    {
+      if (it->second.LastFrame < this->Frame)
+      {
+        candidates.push_back(it);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+      [](const auto& a, const auto& b) { return a->second.LastFrame < b->second.LastFrame; });
+
+    for (auto it : candidates)
+    {
+      if (this->CachedSize <= this->MemoryBudget)
+      {
+        break;
+      }
+      this->CachedSize -= it->second.Size;
+      it->second.Actor->GetTexture()->ReleaseGraphicsResources(window);
+      it->second.Actor->GetMapper()->ReleaseGraphicsResources(window);
+      this->Tiles.erase(it);
+    }
+  }
+
+  fs::path Directory;
+  std::vector<Level> Levels;
+  int TileSize = 0;
+  int ScalarType = VTK_UNSIGNED_CHAR;
+  int NumberOfComponents = 0;
+
+  std::map<TileKey, Tile> Tiles;
+  std::vector<vtkActor*> Visible;
+  vtkTypeInt64 CachedSize = 0;
+  vtkTypeInt64 MemoryBudget = 0;
+  std::uint64_t Frame = 0;
+
+  std::future<bool> Future;
+  std::atomic<bool> Abort{ false };
+  std::atomic<int> BuiltLevels{ 0 };
+};
+
+vtkStandardNewMacro(vtkF3DTiledImageActor);
+
+//----------------------------------------------------------------------------
+vtkF3DTiledImageActor::vtkF3DTiledImageActor()
+  : Internals(new vtkF3DTiledImageActor::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkF3DTiledImageActor::~vtkF3DTiledImageActor() = default;
+
+//----------------------------------------------------------------------------
+void vtkF3DTiledImageActor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "TileSize: " << this->TileSize << "\n";
+  os << indent << "MemoryBudget: " << this->MemoryBudget << "\n";
+  os << indent << "UseSRGBColorSpace: " << this->UseSRGBColorSpace << "\n";
+  os << indent << "NumberOfLevels: " << this->GetNumberOfLevels() << "\n";
+  os << indent << "NumberOfCachedTiles: " << this->GetNumberOfCachedTiles() << "\n";
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DTiledImageActor::SetImage(vtkImageData* image)
+{
+  vtkInternals& internals = *this->Internals;
+  internals.StopBuild();
+  internals.BuiltLevels = 0;
+  internals.Visible.clear();
+  internals.Tiles.clear();
+  internals.CachedSize = 0;
+  internals.Levels.clear();
+  internals.RemoveTileDirectory();
+
+  vtkDataArray* scalars = image ? image->GetPointData()->GetScalars() : nullptr;
+  int dims[3] = { 0, 0, 0 };
+  if (image)
+  {
+    image->GetDimensions(dims);
+  }
+  if (!scalars || dims[0] < 1 || dims[1] < 1 || dims[2] != 1)
+  {
+    vtkErrorMacro("Only 2D images with scalars are supported");
+    return false;
+  }
+
+  if (!internals.CreateTileDirectory())
+  {
+    vtkErrorMacro("Could not create a temporary directory for the tiles");
+    return false;
+  }
+
+  internals.TileSize = this->TileSize;
+  internals.ScalarType = scalars->GetDataType();
+  internals.NumberOfComponents = scalars->GetNumberOfComponents();
+
+  // Halve the resolution until a level fits in a single tile
+  std::array<int, 2> levelDims = { dims[0], dims[1] };
+  while (true)
+  {
+    vtkInternals::Level level;
+    level.Dimensions = levelDims;
+    for (int i = 0; i < 2; i++)
+    {
+      level.NumberOfTiles[i] = (levelDims[i] + this->TileSize - 1) / this->TileSize;
+    }
+    internals.Levels.push_back(level);
+
+    if ((levelDims[0] <= this->TileSize && levelDims[1] <= this->TileSize) ||
+      levelDims[0] < 2 || levelDims[1] < 2)
+    {
+      break;
+    }
+    levelDims = { levelDims[0] / 2, levelDims[1] / 2 };
+  }
+
+  // The full resolution tiles are copied from the image
+  if (!internals.WriteTiles(0, image))
+  {
+    vtkErrorMacro("Could not write a tile in " << internals.Directory.string());
+    internals.Levels.clear();
+    return false;
+  }
+  internals.BuiltLevels = 1;
+
+  // The coarsest level is reduced from the image in a single pass, so the image is displayed
+  // right away
+  const int coarsest = static_cast<int>(internals.Levels.size()) - 1;
+  if (coarsest > 0)
+  {
+    vtkNew<vtkImageShrink3D> shrink;
+    shrink->SetInputData(image);
+    shrink->SetShrinkFactors(1 << coarsest, 1 << coarsest, 1);
+    shrink->AveragingOn();
+    shrink->Update();
+    if (!internals.WriteTiles(coarsest, shrink->GetOutput()))
+    {
+      vtkErrorMacro("Could not write a tile in " << internals.Directory.string());
+      internals.Levels.clear();
+      return false;
+    }
+  }
+
+  // The intermediate levels are built in the background as the image is not needed anymore
+  if (coarsest > 1)
+  {
+    internals.Future = std::async(std::launch::async, &vtkInternals::BuildLevels, &internals);
+  }
+
+  // The actor mapper input covers the whole image, for the bounds and the picking
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputData(
+    ::CreateQuad(0.0, 0.0, static_cast<double>(dims[0]), static_cast<double>(dims[1])));
+  this->SetMapper(mapper);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DTiledImageActor::GetNumberOfLevels() const
+{
+  return static_cast<int>(this->Internals->Levels.size());
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkImageData> vtkF3DTiledImageActor::ReadTile(int level, int x, int y) const
+{
+  int ext[6];
+  if (!this->Internals->GetTileExtent(level, x, y, ext) || !this->Internals->IsLevelBuilt(level))
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkImageData> tile = this->Internals->ReadTile(level, x, y);
+  if (!tile)
+  {
+    vtkErrorMacro("Could not read tile " << level << " " << x << " " << y);
+  }
+  return tile;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DTiledImageActor::Wait()
+{
+  if (this->Internals->Future.valid())
+  {
+    this->Internals->Future.wait();
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DTiledImageActor::GetNumberOfCachedTiles() const
+{
+  return static_cast<int>(this->Internals->Tiles.size());
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DTiledImageActor::RenderOpaqueGeometry(vtkViewport* viewport)
+{
+  vtkRenderer* ren = vtkRenderer::SafeDownCast(viewport);
+  if (!ren)
+  {
+    return 0;
+  }
+
+  // The opaque pass comes first, the tiles selected here are reused by the translucent pass
+  this->Internals->MemoryBudget = this->MemoryBudget;
+  this->Internals->SelectTiles(this, ren);
+
+  int rendered = 0;
+  for (vtkActor* tile : this->Internals->Visible)
+  {
+    rendered += tile->RenderOpaqueGeometry(viewport);
+  }
+  return rendered;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DTiledImageActor::RenderTranslucentPolygonalGeometry(vtkViewport* viewport)
+{
+  int rendered = 0;
+  for (vtkActor* tile : this->Internals->Visible)
+  {
+    rendered += tile->RenderTranslucentPolygonalGeometry(viewport);
+  }
+  return rendered;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DTiledImageActor::GetIsOpaque()
+{
+  // One or two components are luminance, three or four are RGB, with alpha for the even ones
+  return this->Superclass::GetIsOpaque() && this->Internals->NumberOfComponents % 2 == 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DTiledImageActor::ReleaseGraphicsResources(vtkWindow* window)
+{
+  for (auto& [key, tile] : this->Internals->Tiles)
+  {
+    tile.Actor->ReleaseGraphicsResources(window);
+  }
+  this->Superclass::ReleaseGraphicsResources(window);
+}
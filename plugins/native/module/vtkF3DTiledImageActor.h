@@ -0,0 +1,132 @@
+/**
+ * @class   vtkF3DTiledImageActor
+ * @brief   Actor displaying a very large image as a pyramid of tiles
+ *
+ * This actor splits an image into square tiles and builds a pyramid of levels of detail, each
+ * level halving the resolution of the previous one, until a level fits in a single tile.
+ * The tiles are stored in a temporary directory on disk, so the image does not need to be kept
+ * in memory nor to fit in a single texture.
+ * Only the full resolution and the coarsest levels are written when the image is set, the
+ * intermediate levels are built from them in a background thread and used once built.
+ *
+ * On rendering, the pyramid is traversed from the coarsest level and a tile is refined while
+ * one of its pixels covers more than one pixel on screen. Only the tiles visible from the camera
+ * are read, and the image is refined while zooming. Read tiles are kept in a cache limited by
+ * MemoryBudget, the least recently rendered ones being released first.
+ *
+ * The image is displayed in the [0, width] x [0, height] rectangle of the z=0 plane, like a
+ * textured quad, which is also the input of the mapper of the actor.
+ */
+
+#ifndef vtkF3DTiledImageActor_h
+#define vtkF3DTiledImageActor_h
+
+#include <vtkActor.h>
+#include <vtkSmartPointer.h>
+
+#include <memory>
+
+class vtkImageData;
+
+class vtkF3DTiledImageActor : public vtkActor
+{
+public:
+  static vtkF3DTiledImageActor* New();
+  vtkTypeMacro(vtkF3DTiledImageActor, vtkActor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the size of the tiles in pixels.
+   * Must be set before SetImage.
+   * Default is 1024.
+   */
+  vtkSetClampMacro(TileSize, int, 16, 16384);
+  vtkGetMacro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum size in bytes of the tiles kept in memory.
+   * The tiles rendered in the last frame are always kept.
+   * Default is 512 MiB.
+   */
+  vtkSetMacro(MemoryBudget, vtkTypeInt64);
+  vtkGetMacro(MemoryBudget, vtkTypeInt64);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get if the textures of the tiles are in sRGB color space.
+   * Must be set before rendering.
+   * Default is false.
+   */
+  vtkSetMacro(UseSRGBColorSpace, bool);
+  vtkGetMacro(UseSRGBColorSpace, bool);
+  vtkBooleanMacro(UseSRGBColorSpace, bool);
+  ///@}
+
+  /**
+   * Split the 2D image in tiles and start building the pyramid on disk.
+   * The image is not referenced afterwards.
+   * Return false if the image is not supported or the tiles could not be written.
+   */
+  bool SetImage(vtkImageData* image);
+
+  /**
+   * Block until all the levels of the pyramid are built.
+   */
+  void Wait();
+
+  /**
+   * Get the number of levels of the pyramid, 0 if no image is set.
+   */
+  int GetNumberOfLevels() const;
+
+  /**
+   * Read a tile of the pyramid from the disk, return nullptr if it does not exist or if its
+   * level is not built yet.
+   * The extent of the returned image is the extent of the tile in the pixels of its level.
+   */
+  vtkSmartPointer<vtkImageData> ReadTile(int level, int x, int y) const;
+
+  /**
+   * Get the number of tiles currently kept in memory.
+   */
+  int GetNumberOfCachedTiles() const;
+
+  ///@{
+  /**
+   * Render the tiles visible from the camera, reading them if needed.
+   */
+  int RenderOpaqueGeometry(vtkViewport* viewport) override;
+  int RenderTranslucentPolygonalGeometry(vtkViewport* viewport) override;
+  ///@}
+
+  /**
+   * Images with an alpha channel are translucent.
+   */
+  bool GetIsOpaque() override;
+
+  /**
+   * Release the graphics resources of the cached tiles.
+   */
+  void ReleaseGraphicsResources(vtkWindow* window) override;
+
+protected:
+  vtkF3DTiledImageActor();
+  ~vtkF3DTiledImageActor() override;
+
+  int TileSize = 1024;
+  vtkTypeInt64 MemoryBudget = vtkTypeInt64(512) << 20;
+  bool UseSRGBColorSpace = false;
+
+private:
+  vtkF3DTiledImageActor(const vtkF3DTiledImageActor&) = delete;
+  void operator=(const vtkF3DTiledImageActor&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -1,15 +1,273 @@
-void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream*) const override
+void applyCustomReader(
+  vtkAlgorithm* algo, const std::string& fileName, vtkResourceStream* stream) const override
 {
   vtkOpenVDBReader* vdbReader = vtkOpenVDBReader::SafeDownCast(algo);
 
-  // No check needed, we know the option exists
+  // No check needed, we know the options exist
   std::string optName = "VDB.downsampling_factor";
   std::string dsOptStr = this->ReaderOptions.at(optName);
+  std::string maxVoxelsOptName = "VDB.max_voxels";
+  std::string maxVoxelsOptStr = this->ReaderOptions.at(maxVoxelsOptName);
 
   // 0.1 is an arbitrary default that let us read sample files from OpenVDB in a reasonable time frame
   double dsFactor = F3DUtils::ParseToDouble(dsOptStr, 0.1, optName);
+
+  // Without an explicit downsampling factor, use the largest one fitting the voxel budget
+  double maxVoxels = F3DUtils::ParseToDouble(maxVoxelsOptStr, 0.0, maxVoxelsOptName);
+  if (dsOptStr.empty() && maxVoxels > 0.0)
+  {
+    double denseVoxels = 0.0;
+    if (stream)
+    {
+      denseVoxels = this->ReadDenseVoxelCount(
+        [&](void* buffer, size_t size) { return stream->Read(buffer, size) == size; },
+        [&](vtkTypeInt64 pos)
+        { return stream->Seek(pos, vtkResourceStream::SeekDirection::Begin) == pos; });
+      stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+    }
+    else
+    {
+      std::ifstream file(vtksys::SystemTools::CollapseFullPath(fileName), std::ios::binary);
+      denseVoxels = this->ReadDenseVoxelCount(
+        [&](void* buffer, size_t size)
+        {
+          return static_cast<bool>(
+            file.read(static_cast<char*>(buffer), static_cast<std::streamsize>(size)));
+        },
+        [&](vtkTypeInt64 pos) { return static_cast<bool>(file.seekg(pos)); });
+    }
+
+    if (denseVoxels > 0.0)
+    {
+      // The factor applies to each axis
+      dsFactor = std::min(1.0, std::cbrt(maxVoxels / denseVoxels));
+    }
+  }
   vdbReader->SetDownsamplingFactor(dsFactor);
 
   // Merge volumes together
   vdbReader->MergeImageVolumesOn();
 }
+
+/**
+ * Compute the number of voxels of a dense image covering the active voxels of all the grids,
+ * from the bounding boxes and transforms OpenVDB stores in the metadata of each grid.
+ * The bounding boxes are in the index space of each grid, so their union is computed in world
+ * space, with the smallest voxel size of the grids.
+ * Only the header, the grid descriptors, the grid metadata and transforms are read, not the trees.
+ * Return 0 if the file is not supported, the bounding boxes are missing or a grid uses a frustum
+ * transform.
+ */
+template<typename ReadFunction, typename SeekFunction>
+static double ReadDenseVoxelCount(ReadFunction read, SeekFunction seek)
+{
+  auto readValue = [&](auto& value) { return read(&value, sizeof(value)); };
+  auto readString = [&](std::string& str)
+  {
+    vtkTypeUInt32 size = 0;
+    if (!readValue(size) || size > (1u << 24))
+    {
+      return false;
+    }
+    str.resize(size);
+    return size == 0 || read(str.data(), size);
+  };
+
+  // Read a metadata map, calling the provided function on each entry
+  std::vector<char> data;
+  auto readMetadata = [&](auto onEntry)
+  {
+    vtkTypeUInt32 count = 0;
+    if (!readValue(count))
+    {
+      return false;
+    }
+    std::string name;
+    std::string type;
+    for (vtkTypeUInt32 i = 0; i < count; i++)
+    {
+      vtkTypeUInt32 size = 0;
+      if (!readString(name) || !readString(type) || !readValue(size) || size > (1u << 24))
+      {
+        return false;
+      }
+      data.resize(size);
+      if (size > 0 && !read(data.data(), size))
+      {
+        return false;
+      }
+      onEntry(name, type, data);
+    }
+    return true;
+  };
+
+  // Read a grid transform as an affine matrix, OpenVDB transforming row vectors
+  auto readTransform = [&](double matrix[4][3])
+  {
+    std::string type;
+    if (!readString(type))
+    {
+      return false;
+    }
+    double translation[3] = { 0.0, 0.0, 0.0 };
+    double scale[3] = { 1.0, 1.0, 1.0 };
+    double cached[12]; // inverse scales and voxel size, derived from the scale
+    if (type == "AffineMap" || type == "UnitaryMap")
+    {
+      double values[4][4];
+      if (!readValue(values))
+      {
+        return false;
+      }
+      for (int row = 0; row < 4; row++)
+      {
+        std::copy(values[row], values[row] + 3, matrix[row]);
+      }
+      return true;
+    }
+    else if (type == "ScaleMap" || type == "UniformScaleMap")
+    {
+      if (!readValue(scale) || !readValue(cached))
+      {
+        return false;
+      }
+    }
+    else if (type == "ScaleTranslateMap" || type == "UniformScaleTranslateMap")
+    {
+      if (!readValue(translation) || !readValue(scale) || !readValue(cached))
+      {
+        return false;
+      }
+    }
+    else if (type == "TranslationMap")
+    {
+      if (!readValue(translation))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      return false;
+    }
+    for (int row = 0; row < 3; row++)
+    {
+      std::fill(matrix[row], matrix[row] + 3, 0.0);
+      matrix[row][row] = scale[row];
+    }
+    std::copy(translation, translation + 3, matrix[3]);
+    return true;
+  };
+
+  // Header, only versions with grid offsets and per grid compression are supported
+  vtkTypeInt64 magic = 0;
+  vtkTypeUInt32 version = 0;
+  vtkTypeUInt32 libraryVersion[2];
+  char hasGridOffsets = 0;
+  char uuid[36];
+  if (!readValue(magic) || magic != 0x56444220 || !readValue(version) || version < 222 ||
+    !readValue(libraryVersion) || !readValue(hasGridOffsets) || !hasGridOffsets ||
+    !readValue(uuid) || !readMetadata([](auto&&...) {}))
+  {
+    return 0.0;
+  }
+
+  // Grid descriptors
+  vtkTypeInt32 gridCount = 0;
+  if (!readValue(gridCount))
+  {
+    return 0.0;
+  }
+  std::vector<vtkTypeInt64> gridPositions;
+  std::string name;
+  for (vtkTypeInt32 i = 0; i < gridCount; i++)
+  {
+    vtkTypeInt64 positions[3]; // grid, blocks and end
+    if (!readString(name) || !readString(name) || !readString(name) || !readValue(positions))
+    {
+      return 0.0;
+    }
+    gridPositions.push_back(positions[0]);
+    if (!seek(positions[2]))
+    {
+      return 0.0;
+    }
+  }
+
+  // Union of the active voxel bounding boxes of the grids in world space
+  double worldMin[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  double worldMax[3] = { VTK_DOUBLE_MIN, VTK_DOUBLE_MIN, VTK_DOUBLE_MIN };
+  double voxelSize[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  for (vtkTypeInt64 position : gridPositions)
+  {
+    vtkTypeUInt32 compression = 0;
+    vtkTypeInt32 bboxMin[3];
+    vtkTypeInt32 bboxMax[3];
+    bool hasBBoxMin = false;
+    bool hasBBoxMax = false;
+    auto onEntry =
+      [&](const std::string& key, const std::string& type, const std::vector<char>& value)
+    {
+      if (type != "vec3i" || value.size() != 3 * sizeof(vtkTypeInt32))
+      {
+        return;
+      }
+      const vtkTypeInt32* coords = reinterpret_cast<const vtkTypeInt32*>(value.data());
+      if (key == "file_bbox_min")
+      {
+        std::copy(coords, coords + 3, bboxMin);
+        hasBBoxMin = true;
+      }
+      else if (key == "file_bbox_max")
+      {
+        std::copy(coords, coords + 3, bboxMax);
+        hasBBoxMax = true;
+      }
+    };
+    double matrix[4][3];
+    if (!seek(position) || !readValue(compression) || !readMetadata(onEntry) || !hasBBoxMin ||
+      !hasBBoxMax || !readTransform(matrix))
+    {
+      return 0.0;
+    }
+
+    // Transform the corners of the voxels on the bounding box
+    for (int corner = 0; corner < 8; corner++)
+    {
+      double index[3];
+      for (int axis = 0; axis < 3; axis++)
+      {
+        index[axis] = (corner & (1 << axis)) ? bboxMax[axis] + 0.5 : bboxMin[axis] - 0.5;
+      }
+      for (int axis = 0; axis < 3; axis++)
+      {
+        const double world = index[0] * matrix[0][axis] + index[1] * matrix[1][axis] +
+          index[2] * matrix[2][axis] + matrix[3][axis];
+        worldMin[axis] = std::min(worldMin[axis], world);
+        worldMax[axis] = std::max(worldMax[axis], world);
+      }
+    }
+
+    // Size of a voxel along each world axis
+    for (int axis = 0; axis < 3; axis++)
+    {
+      const double size = std::sqrt(matrix[0][axis] * matrix[0][axis] +
+        matrix[1][axis] * matrix[1][axis] + matrix[2][axis] * matrix[2][axis]);
+      if (size > 0.0)
+      {
+        voxelSize[axis] = std::min(voxelSize[axis], size);
+      }
+    }
+  }
+
+  double voxels = gridPositions.empty() ? 0.0 : 1.0;
+  for (int axis = 0; axis < 3; axis++)
+  {
+    if (voxelSize[axis] == VTK_DOUBLE_MAX)
+    {
+      return 0.0;
+    }
+    voxels *= std::max(1.0, std::round((worldMax[axis] - worldMin[axis]) / voxelSize[axis]));
+  }
+  return voxels;
+}
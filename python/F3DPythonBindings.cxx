@@ -805,6 +805,8 @@ PYBIND11_MODULE(pyf3d, module)
   py::class_<f3d::scene, std::unique_ptr<f3d::scene, py::nodelete>> scene(module, "Scene");
   scene //
     .def("supports", &f3d::scene::supports)
+    .def("reload", &f3d::scene::reload, "Reload a file previously added to the scene",
+      py::arg("file_path"))
     .def("clear", &f3d::scene::clear)
     .def("get_added_files", &f3d::scene::getAddedFiles,
       "Return the list of files currently added to the scene")
@@ -931,6 +933,9 @@ PYBIND11_MODULE(pyf3d, module)
     .def("render", &f3d::window::render, "Render the window")
     .def("render_to_image", &f3d::window::renderToImage, "Render the window to an image",
       py::arg("no_background") = false)
+    .def("render_views", &f3d::window::renderViews,
+      "Render the window once for each camera state to a list of images", py::arg("states"),
+      py::arg("no_background") = false)
     .def("set_icon", &f3d::window::setIcon,
       "Set the icon of the window using a memory buffer representing a PNG file")
     .def("set_window_name", &f3d::window::setWindowName, "Set the window name")
@@ -20,3 +20,19 @@ def test_window_position():
     assert isinstance(pos, tuple) and len(pos) == 2
     assert engine.window.left == pos[0]
     assert engine.window.top == pos[1]
+
+
+def test_window_render_views():
+    engine = f3d.Engine.create(True)
+    engine.window.size = 300, 200
+    camera = engine.window.camera
+    initial_state = camera.state
+
+    states = [camera.state for _ in range(3)]
+    states[1].position = (1, 2, 3)
+    images = engine.window.render_views(states, True)
+    assert len(images) == 3
+    assert all(img.width == 300 and img.height == 200 for img in images)
+    assert all(img.channel_count == 4 for img in images)
+    assert camera.state.position == initial_state.position
+    assert engine.window.render_views([]) == []
@@ -0,0 +1,277 @@
+#include "F3DFrustumCuller.h"
+
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPointData.h>
+#include <vtkPointGaussianMapper.h>
+#include <vtkProp.h>
+#include <vtkRenderer.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Maximum number of props in a leaf of the hierarchy
+constexpr int MaxLeafSize = 4;
+
+enum class Containment
+{
+  Outside,
+  Intersect,
+  Inside
+};
+
+//----------------------------------------------------------------------------
+// Test a box against the frustum planes, their normals pointing inward
+Containment TestBox(const std::array<double, 6>& bounds, const double planes[24])
+{
+  Containment result = Containment::Inside;
+  for (int i = 0; i < 6; i++)
+  {
+    const double* plane = planes + 4 * i;
+
+    // corners of the box the farthest along and against the normal of the plane
+    double positive = plane[3];
+    double negative = plane[3];
+    for (int axis = 0; axis < 3; axis++)
+    {
+      const double min = plane[axis] * bounds[2 * axis];
+      const double max = plane[axis] * bounds[2 * axis + 1];
+      positive += std::max(min, max);
+      negative += std::min(min, max);
+    }
+
+    if (positive < 0.0)
+    {
+      return Containment::Outside;
+    }
+    if (negative < 0.0)
+    {
+      result = Containment::Intersect;
+    }
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// The bounds of a prop rendered with point sprites or gaussian splats only contain the points,
+// return the world radius of its largest sprite so that the bounds can be padded
+double GetSpriteRadius(vtkProp* prop)
+{
+  vtkActor* actor = vtkActor::SafeDownCast(prop);
+  vtkPointGaussianMapper* mapper =
+    actor ? vtkPointGaussianMapper::SafeDownCast(actor->GetMapper()) : nullptr;
+  if (!mapper || mapper->GetScaleFactor() == 0.0)
+  {
+    return 0.0;
+  }
+
+  double radius = mapper->GetScaleFactor() * mapper->GetBoundScale();
+
+  // the scale array multiplies the scale factor of each point
+  vtkDataSet* input = mapper->GetInput();
+  vtkDataArray* scales = input && mapper->GetScaleArray()
+    ? input->GetPointData()->GetArray(mapper->GetScaleArray())
+    : nullptr;
+  if (scales)
+  {
+    double maxScale = 0.0;
+    for (int comp = 0; comp < scales->GetNumberOfComponents(); comp++)
+    {
+      const double* range = scales->GetRange(comp);
+      maxScale = std::max({ maxScale, std::abs(range[0]), std::abs(range[1]) });
+    }
+    radius *= maxScale;
+  }
+
+  // the sprites are scaled by the transform of the actor
+  vtkMatrix4x4* matrix = actor->GetMatrix();
+  double maxAxisScale = 0.0;
+  for (int col = 0; col < 3; col++)
+  {
+    const double axis[3] = { matrix->GetElement(0, col), matrix->GetElement(1, col),
+      matrix->GetElement(2, col) };
+    maxAxisScale = std::max(maxAxisScale, vtkMath::Norm(axis));
+  }
+  return radius * maxAxisScale;
+}
+}
+
+//----------------------------------------------------------------------------
+void F3DFrustumCuller::Cull(vtkRenderer* renderer, const std::vector<vtkProp*>& props,
+  const std::vector<vtkProp*>& nonCullableProps, std::vector<vtkProp*>& visibleProps)
+{
+  if (this->NeedsRebuild(props, nonCullableProps))
+  {
+    this->Build(props, nonCullableProps);
+  }
+
+  // mark all non cullable props as visible, then walk the hierarchy
+  this->Visible.assign(this->Cullable.size(), false);
+  for (size_t i = 0; i < this->Cullable.size(); i++)
+  {
+    this->Visible[i] = !this->Cullable[i];
+  }
+
+  if (!this->Nodes.empty())
+  {
+    double planes[24];
+    renderer->GetActiveCamera()->GetFrustumPlanes(renderer->GetTiledAspectRatio(), planes);
+
+    std::vector<int> stack = { 0 };
+    while (!stack.empty())
+    {
+      const Node& node = this->Nodes[stack.back()];
+      const int nodeIndex = stack.back();
+      stack.pop_back();
+
+      const Containment containment = ::TestBox(node.Bounds, planes);
+      if (containment == Containment::Outside)
+      {
+        continue;
+      }
+
+      if (containment == Containment::Inside || node.Count <= ::MaxLeafSize)
+      {
+        // the whole node is visible, or test the props of the leaf individually
+        for (int i = node.First; i < node.First + node.Count; i++)
+        {
+          const Item& item = this->Items[i];
+          if (containment == Containment::Inside ||
+            ::TestBox(item.Bounds, planes) != Containment::Outside)
+          {
+            this->Visible[item.PropIndex] = true;
+          }
+        }
+        continue;
+      }
+
+      stack.push_back(node.SecondChild);
+      stack.push_back(nodeIndex + 1);
+    }
+  }
+
+  visibleProps.clear();
+  for (size_t i = 0; i < props.size(); i++)
+  {
+    if (this->Visible[i])
+    {
+      visibleProps.push_back(props[i]);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool F3DFrustumCuller::NeedsRebuild(
+  const std::vector<vtkProp*>& props, const std::vector<vtkProp*>& nonCullableProps) const
+{
+  if (props != this->Props || nonCullableProps != this->NonCullableProps)
+  {
+    return true;
+  }
+
+  // the redraw time includes the transform of the prop and the input of its mapper
+  const vtkMTimeType buildTime = this->BuildTime.GetMTime();
+  return std::any_of(this->Items.begin(), this->Items.end(),
+    [&](const Item& item) { return props[item.PropIndex]->GetRedrawMTime() > buildTime; });
+}
+
+//----------------------------------------------------------------------------
+void F3DFrustumCuller::Build(
+  const std::vector<vtkProp*>& props, const std::vector<vtkProp*>& nonCullableProps)
+{
+  this->Props = props;
+  this->NonCullableProps = nonCullableProps;
+  this->Cullable.assign(props.size(), false);
+  this->Items.clear();
+  this->Nodes.clear();
+
+  for (size_t i = 0; i < props.size(); i++)
+  {
+    vtkProp* prop = props[i];
+    if (!prop->GetUseBounds() ||
+      std::find(nonCullableProps.begin(), nonCullableProps.end(), prop) !=
+        nonCullableProps.end())
+    {
+      continue;
+    }
+
+    const double* bounds = prop->GetBounds();
+    if (!bounds || !vtkMath::AreBoundsInitialized(bounds))
+    {
+      continue;
+    }
+
+    Item item;
+    const double radius = ::GetSpriteRadius(prop);
+    for (int axis = 0; axis < 3; axis++)
+    {
+      item.Bounds[2 * axis] = bounds[2 * axis] - radius;
+      item.Bounds[2 * axis + 1] = bounds[2 * axis + 1] + radius;
+      item.Center[axis] = 0.5 * (bounds[2 * axis] + bounds[2 * axis + 1]);
+    }
+    item.PropIndex = static_cast<int>(i);
+    this->Items.push_back(item);
+    this->Cullable[i] = true;
+  }
+
+  if (!this->Items.empty())
+  {
+    this->Nodes.reserve(2 * this->Items.size() / ::MaxLeafSize + 1);
+    this->BuildNode(0, static_cast<int>(this->Items.size()));
+  }
+  this->BuildTime.Modified();
+}
+
+//----------------------------------------------------------------------------
+void F3DFrustumCuller::BuildNode(int first, int count)
+{
+  const int nodeIndex = static_cast<int>(this->Nodes.size());
+  this->Nodes.push_back({ {}, first, count, -1 });
+
+  std::array<double, 6> bounds = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX,
+    VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  std::array<double, 6> centers = bounds;
+  for (int i = first; i < first + count; i++)
+  {
+    const Item& item = this->Items[i];
+    for (int axis = 0; axis < 3; axis++)
+    {
+      bounds[2 * axis] = std::min(bounds[2 * axis], item.Bounds[2 * axis]);
+      bounds[2 * axis + 1] = std::max(bounds[2 * axis + 1], item.Bounds[2 * axis + 1]);
+      centers[2 * axis] = std::min(centers[2 * axis], item.Center[axis]);
+      centers[2 * axis + 1] = std::max(centers[2 * axis + 1], item.Center[axis]);
+    }
+  }
+  this->Nodes[nodeIndex].Bounds = bounds;
+
+  if (count <= ::MaxLeafSize)
+  {
+    return;
+  }
+
+  // split at the median of the centers along the longest axis
+  int splitAxis = 0;
+  for (int axis = 1; axis < 3; axis++)
+  {
+    if (centers[2 * axis + 1] - centers[2 * axis] >
+      centers[2 * splitAxis + 1] - centers[2 * splitAxis])
+    {
+      splitAxis = axis;
+    }
+  }
+
+  const int half = count / 2;
+  std::nth_element(this->Items.begin() + first, this->Items.begin() + first + half,
+    this->Items.begin() + first + count, [splitAxis](const Item& a, const Item& b)
+    { return a.Center[splitAxis] < b.Center[splitAxis]; });
+
+  this->BuildNode(first, half);
+  this->Nodes[nodeIndex].SecondChild = static_cast<int>(this->Nodes.size());
+  this->BuildNode(first + half, count - half);
+}
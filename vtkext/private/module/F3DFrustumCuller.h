@@ -0,0 +1,83 @@
+/**
+ * @class F3DFrustumCuller
+ * @brief A bounding volume hierarchy used to cull props outside of the camera frustum
+ *
+ * The hierarchy is built from the world bounds of the props and is only rebuilt when the list
+ * of props changes or when one of them is modified, so each frame only has to walk the
+ * hierarchy with the frustum planes of the camera.
+ * The bounds of props rendered with point sprites or gaussian splats are padded by the size of
+ * their largest sprite.
+ * Props without bounds, props not using their bounds and props added as non cullable,
+ * eg: skinned meshes deformed on the GPU, are always considered visible.
+ */
+#ifndef F3DFrustumCuller_h
+#define F3DFrustumCuller_h
+
+#include <vtkTimeStamp.h>
+
+#include <array>
+#include <vector>
+
+class vtkProp;
+class vtkRenderer;
+
+class F3DFrustumCuller
+{
+public:
+  /**
+   * Fill visibleProps with the props that intersect the frustum of the active camera of the
+   * renderer, in the same order as props.
+   * nonCullableProps must be a subset of props and are always visible.
+   */
+  void Cull(vtkRenderer* renderer, const std::vector<vtkProp*>& props,
+    const std::vector<vtkProp*>& nonCullableProps, std::vector<vtkProp*>& visibleProps);
+
+private:
+  /**
+   * Check if the hierarchy must be rebuilt for the provided props.
+   */
+  bool NeedsRebuild(
+    const std::vector<vtkProp*>& props, const std::vector<vtkProp*>& nonCullableProps) const;
+
+  /**
+   * Build the hierarchy from the props.
+   */
+  void Build(const std::vector<vtkProp*>& props, const std::vector<vtkProp*>& nonCullableProps);
+
+  /**
+   * Recursively build the node covering the items [first, first + count).
+   */
+  void BuildNode(int first, int count);
+
+  /**
+   * A node of the hierarchy, covering the items [First, First + Count).
+   * The first child of an inner node is the next node, SecondChild is the index of the other.
+   */
+  struct Node
+  {
+    std::array<double, 6> Bounds;
+    int First;
+    int Count;
+    int SecondChild;
+  };
+
+  /**
+   * A cullable prop with its world bounds and its index in the props.
+   */
+  struct Item
+  {
+    std::array<double, 6> Bounds;
+    std::array<double, 3> Center;
+    int PropIndex;
+  };
+
+  std::vector<vtkProp*> Props;
+  std::vector<vtkProp*> NonCullableProps;
+  std::vector<bool> Cullable;
+  std::vector<Item> Items;
+  std::vector<Node> Nodes;
+  std::vector<bool> Visible;
+  vtkTimeStamp BuildTime;
+};
+
+#endif
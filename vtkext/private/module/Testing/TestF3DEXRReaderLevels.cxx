@@ -0,0 +1,79 @@
+#include <vtkImageData.h>
+#include <vtkNew.h>
+
+#include "vtkF3DEXRReader.h"
+
+#include <ImfRgbaFile.h>
+#include <ImfTiledRgbaFile.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+bool CheckLevel(vtkF3DEXRReader* reader, int maximumWidth, int expectedLevel, int expectedWidth,
+  int expectedHeight, float expectedValue)
+{
+  reader->SetMaximumWidth(maximumWidth);
+  reader->Update();
+
+  const int* dims = reader->GetOutput()->GetDimensions();
+  const float value = reader->GetOutput()->GetScalarComponentAsFloat(0, 0, 0, 0);
+  if (reader->GetLevel() != expectedLevel || dims[0] != expectedWidth ||
+    dims[1] != expectedHeight || value != expectedValue)
+  {
+    std::cerr << "Unexpected output with a maximum width of " << maximumWidth << ": level "
+              << reader->GetLevel() << ", " << dims[0] << "x" << dims[1] << ", value " << value
+              << "\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DEXRReaderLevels(int vtkNotUsed(argc), char* argv[])
+{
+  // Tiled file with mipmap levels, the pixels of the level l being l + 1
+  const std::string tiledFileName = std::string(argv[2]) + "/TestF3DEXRReaderLevels.exr";
+  {
+    Imf::TiledRgbaOutputFile file(tiledFileName.c_str(), 1024, 512, 64, 64, Imf::MIPMAP_LEVELS,
+      Imf::ROUND_DOWN, Imf::WRITE_RGB);
+    for (int level = 0; level < file.numLevels(); level++)
+    {
+      const int width = file.levelWidth(level);
+      const int height = file.levelHeight(level);
+      const float value = static_cast<float>(level + 1);
+      std::vector<Imf::Rgba> pixels(width * height, Imf::Rgba(value, value, value));
+      file.setFrameBuffer(pixels.data(), 1, width);
+      file.writeTiles(0, file.numXTiles(level) - 1, 0, file.numYTiles(level) - 1, level);
+    }
+  }
+
+  vtkNew<vtkF3DEXRReader> reader;
+  reader->SetFileName(tiledFileName.c_str());
+
+  // Full resolution by default, the finest level fitting in the maximum width otherwise
+  if (!::CheckLevel(reader, 0, 0, 1024, 512, 1.f) || !::CheckLevel(reader, 300, 2, 256, 128, 3.f) ||
+    !::CheckLevel(reader, 2048, 0, 1024, 512, 1.f) || !::CheckLevel(reader, 1, 10, 1, 1, 11.f))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Scanline files are always read at full resolution
+  const std::string scanlineFileName = std::string(argv[2]) + "/TestF3DEXRReaderScanline.exr";
+  {
+    std::vector<Imf::Rgba> pixels(64 * 32, Imf::Rgba(1.f, 1.f, 1.f));
+    Imf::RgbaOutputFile file(scanlineFileName.c_str(), 64, 32, Imf::WRITE_RGB);
+    file.setFrameBuffer(pixels.data(), 1, 64);
+    file.writePixels(32);
+  }
+
+  reader->SetFileName(scanlineFileName.c_str());
+  if (!::CheckLevel(reader, 16, 0, 64, 32, 1.f))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
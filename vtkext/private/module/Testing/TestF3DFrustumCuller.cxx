@@ -0,0 +1,118 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkCellArray.h>
+#include <vtkCubeSource.h>
+#include <vtkNew.h>
+#include <vtkPointGaussianMapper.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSmartPointer.h>
+
+#include "F3DFrustumCuller.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkActor> CreateCube(double x)
+{
+  vtkNew<vtkCubeSource> cube;
+  cube->SetCenter(x, 0, 0);
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(cube->GetOutputPort());
+  mapper->Update();
+  vtkSmartPointer<vtkActor> actor = vtkSmartPointer<vtkActor>::New();
+  actor->SetMapper(mapper);
+  return actor;
+}
+
+vtkSmartPointer<vtkActor> CreateSprite(double x, double radius)
+{
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(x, 0, 0);
+  vtkNew<vtkCellArray> verts;
+  verts->InsertNextCell(1);
+  verts->InsertCellPoint(0);
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetVerts(verts);
+
+  vtkNew<vtkPointGaussianMapper> mapper;
+  mapper->SetInputData(polyData);
+  mapper->SetScaleFactor(radius);
+  mapper->SetBoundScale(1.0);
+  vtkSmartPointer<vtkActor> actor = vtkSmartPointer<vtkActor>::New();
+  actor->SetMapper(mapper);
+  return actor;
+}
+
+bool IsVisible(const std::vector<vtkProp*>& visibleProps, vtkProp* prop)
+{
+  return std::find(visibleProps.begin(), visibleProps.end(), prop) != visibleProps.end();
+}
+}
+
+int TestF3DFrustumCuller(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> window;
+  window->SetSize(300, 300);
+  window->AddRenderer(renderer);
+
+  // The frustum is about 2.68 wide on each side of the focal point
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetPosition(0, 0, 10);
+  camera->SetFocalPoint(0, 0, 0);
+  camera->SetViewUp(0, 1, 0);
+  camera->SetViewAngle(30);
+  camera->SetClippingRange(1, 100);
+
+  vtkSmartPointer<vtkActor> inside = ::CreateCube(0);
+  vtkSmartPointer<vtkActor> partial = ::CreateCube(2.8);
+  vtkSmartPointer<vtkActor> outside = ::CreateCube(10);
+
+  // Sprites whose points are outside of the frustum but not their whole splat
+  vtkSmartPointer<vtkActor> partialSprite = ::CreateSprite(3.5, 1.0);
+  vtkSmartPointer<vtkActor> outsideSprite = ::CreateSprite(5, 1.0);
+
+  std::vector<vtkProp*> props = { inside, partial, outside, partialSprite, outsideSprite };
+  std::vector<vtkProp*> visibleProps;
+  F3DFrustumCuller culler;
+  culler.Cull(renderer, props, {}, visibleProps);
+
+  if (!::IsVisible(visibleProps, inside) || !::IsVisible(visibleProps, partial) ||
+    ::IsVisible(visibleProps, outside))
+  {
+    std::cerr << "Unexpected culling of the cubes\n";
+    return EXIT_FAILURE;
+  }
+
+  if (!::IsVisible(visibleProps, partialSprite) || ::IsVisible(visibleProps, outsideSprite))
+  {
+    std::cerr << "Unexpected culling of the sprites\n";
+    return EXIT_FAILURE;
+  }
+
+  // The hierarchy is rebuilt when the sprites are resized
+  vtkPointGaussianMapper::SafeDownCast(partialSprite->GetMapper())->SetScaleFactor(0.1);
+  culler.Cull(renderer, props, {}, visibleProps);
+  if (::IsVisible(visibleProps, partialSprite))
+  {
+    std::cerr << "Unexpected visible sprite after resizing it\n";
+    return EXIT_FAILURE;
+  }
+
+  // Non cullable props are always visible
+  culler.Cull(renderer, props, { outside }, visibleProps);
+  if (!::IsVisible(visibleProps, outside) || visibleProps.size() != 3)
+  {
+    std::cerr << "Unexpected culling of a non cullable prop\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkSphereSource.h>
+
+#include "vtkF3DMeshLOD.h"
+
+#include <iostream>
+
+int TestF3DMeshLOD(int argc, char* argv[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(400);
+  sphere->SetPhiResolution(400);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  if (vtkF3DMeshLOD::GetLevelsOfDetail(input) != nullptr)
+  {
+    std::cerr << "Levels of detail should not be built for a small mesh\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkF3DMeshLOD* lod = vtkF3DMeshLOD::GetLevelsOfDetail(input, 1000);
+  if (!lod)
+  {
+    std::cerr << "Levels of detail were not created\n";
+    return EXIT_FAILURE;
+  }
+  if (vtkF3DMeshLOD::GetLevelsOfDetail(input, 1000) != lod)
+  {
+    std::cerr << "Levels of detail are not shared\n";
+    return EXIT_FAILURE;
+  }
+
+  lod->Wait();
+  if (lod->GetNumberOfLevels() < 2)
+  {
+    std::cerr << "Unexpected number of levels: " << lod->GetNumberOfLevels() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkIdType previousCells = input->GetNumberOfPolys();
+  for (int i = 0; i < lod->GetNumberOfLevels(); i++)
+  {
+    vtkPolyData* level = lod->GetLevel(i);
+    if (level->GetNumberOfPolys() >= previousCells || level->GetNumberOfPolys() == 0)
+    {
+      std::cerr << "Level " << i << " is not coarser than the previous one\n";
+      return EXIT_FAILURE;
+    }
+    if (!level->GetPointData()->GetNormals())
+    {
+      std::cerr << "Level " << i << " lost the normals\n";
+      return EXIT_FAILURE;
+    }
+    previousCells = level->GetNumberOfPolys();
+  }
+
+  if (lod->SelectLevel(0) != lod->GetLevel(lod->GetNumberOfLevels() - 1) ||
+    lod->SelectLevel(lod->GetLevel(0)->GetNumberOfPolys()) != lod->GetLevel(0) ||
+    lod->SelectLevel(input->GetNumberOfPolys()) != nullptr)
+  {
+    std::cerr << "Unexpected level selection\n";
+    return EXIT_FAILURE;
+  }
+
+  // The current level is kept while the number of cells stays within the hysteresis factor
+  vtkPolyData* level0 = lod->GetLevel(0);
+  vtkPolyData* level1 = lod->GetLevel(1);
+  const double cells0 = static_cast<double>(level0->GetNumberOfPolys());
+  const double cells1 = static_cast<double>(level1->GetNumberOfPolys());
+  if (lod->SelectLevel(cells1 * 1.2, level1, 1.5) != level1 ||
+    lod->SelectLevel(cells0, nullptr, 1.5) != nullptr)
+  {
+    std::cerr << "The current level was not kept within the hysteresis factor\n";
+    return EXIT_FAILURE;
+  }
+  if (lod->SelectLevel(cells0, level1, 1.5) != level0 ||
+    lod->SelectLevel(cells1, nullptr, 1.5) != level1)
+  {
+    std::cerr << "The current level was kept outside of the hysteresis factor\n";
+    return EXIT_FAILURE;
+  }
+
+  input->Modified();
+  if (vtkF3DMeshLOD::GetLevelsOfDetail(input, 1000) == lod)
+  {
+    std::cerr << "Levels of detail were not rebuilt after a modification\n";
+    return EXIT_FAILURE;
+  }
+
+  // The levels being built are not used yet, a new modification means the input is animated
+  input->Modified();
+  if (vtkF3DMeshLOD::GetLevelsOfDetail(input, 1000) != nullptr)
+  {
+    std::cerr << "Levels of detail are built for an animated input\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
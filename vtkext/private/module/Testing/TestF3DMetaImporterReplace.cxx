@@ -0,0 +1,139 @@
+#include "vtkF3DMetaImporter.h"
+
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkCubeSource.h>
+#include <vtkLight.h>
+#include <vtkLightCollection.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+
+#include <iostream>
+
+// CubesImporter : Testing class which creates a configurable number of cubes and lights.
+
+class CubesImporter : public vtkImporter
+{
+public:
+  static CubesImporter* New();
+  vtkTypeMacro(CubesImporter, vtkImporter);
+
+  vtkSetMacro(NumberOfCubes, int);
+  vtkSetMacro(NumberOfLights, int);
+
+  void ImportActors(vtkRenderer* renderer) override
+  {
+    for (int i = 0; i < this->NumberOfCubes; i++)
+    {
+      vtkNew<vtkCubeSource> cube;
+      cube->SetCenter(i, 0, 0);
+      vtkNew<vtkPolyDataMapper> mapper;
+      mapper->SetInputConnection(cube->GetOutputPort());
+      vtkNew<vtkActor> actor;
+      actor->SetMapper(mapper);
+      renderer->AddActor(actor);
+      this->ActorCollection->AddItem(actor);
+    }
+  }
+
+  void ImportLights(vtkRenderer* renderer) override
+  {
+    for (int i = 0; i < this->NumberOfLights; i++)
+    {
+      vtkNew<vtkLight> light;
+      renderer->AddLight(light);
+      this->LightCollection->AddItem(light);
+    }
+  }
+
+private:
+  int NumberOfCubes = 1;
+  int NumberOfLights = 0;
+};
+
+vtkStandardNewMacro(CubesImporter);
+
+namespace
+{
+int CountActors(vtkF3DMetaImporter* metaImporter, vtkImporter* first, vtkImporter* second,
+  vtkRenderer* renderer)
+{
+  metaImporter->AddImporter({ "first", first });
+  metaImporter->AddImporter({ "second", second });
+
+  vtkNew<vtkRenderWindow> window;
+  window->AddRenderer(renderer);
+  metaImporter->SetRenderWindow(window);
+  metaImporter->Update();
+  return renderer->GetActors()->GetNumberOfItems();
+}
+}
+
+int TestF3DMetaImporterReplace(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // Reference: the scene expected after replacing a file, imported directly
+  vtkNew<CubesImporter> expectedFirst;
+  vtkNew<CubesImporter> expectedSecond;
+  vtkNew<vtkF3DMetaImporter> expectedMetaImporter;
+  vtkNew<vtkRenderer> expectedRenderer;
+  const int expectedActors =
+    ::CountActors(expectedMetaImporter, expectedFirst, expectedSecond, expectedRenderer);
+
+  // Scene with a file that is replaced by a different one, with less actors and no light
+  vtkNew<CubesImporter> replacedImporter;
+  replacedImporter->SetNumberOfCubes(3);
+  replacedImporter->SetNumberOfLights(2);
+  vtkNew<CubesImporter> secondImporter;
+  vtkNew<vtkF3DMetaImporter> metaImporter;
+  vtkNew<vtkRenderer> renderer;
+  if (::CountActors(metaImporter, replacedImporter, secondImporter, renderer) <= expectedActors ||
+    renderer->GetLights()->GetNumberOfItems() != 2)
+  {
+    std::cerr << "Unexpected initial scene\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<CubesImporter> newImporter;
+  if (!metaImporter->ReplaceImporter(replacedImporter, { "first", newImporter }))
+  {
+    std::cerr << "Unable to replace the importer\n";
+    return EXIT_FAILURE;
+  }
+  metaImporter->Update();
+
+  vtkActorCollection* replacedActors = replacedImporter->GetImportedActors();
+  vtkCollectionSimpleIterator it;
+  replacedActors->InitTraversal(it);
+  while (vtkActor* actor = replacedActors->GetNextActor(it))
+  {
+    if (renderer->GetActors()->IsItemPresent(actor))
+    {
+      std::cerr << "An actor of the replaced importer is still rendered\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (renderer->GetLights()->GetNumberOfItems() != 0)
+  {
+    std::cerr << "A light of the replaced importer is still rendered\n";
+    return EXIT_FAILURE;
+  }
+
+  if (renderer->GetActors()->GetNumberOfItems() != expectedActors)
+  {
+    std::cerr << "Unexpected number of actors after replace: "
+              << renderer->GetActors()->GetNumberOfItems() << " instead of " << expectedActors
+              << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // Replacing an importer that was not added fails
+  if (metaImporter->ReplaceImporter(replacedImporter, { "first", newImporter }))
+  {
+    std::cerr << "Unexpected replace of an importer that was not added\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
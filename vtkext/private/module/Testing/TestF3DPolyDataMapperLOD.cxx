@@ -0,0 +1,104 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkInformation.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkSphereSource.h>
+
+#include "vtkF3DMeshLOD.h"
+#include "vtkF3DPolyDataMapper.h"
+
+#include <cmath>
+#include <iostream>
+
+int TestF3DPolyDataMapperLOD(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // A sphere with more cells than vtkF3DMeshLOD::MinimumNumberOfCells
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(800);
+  sphere->SetPhiResolution(800);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  vtkF3DMeshLOD* lod = vtkF3DMeshLOD::GetLevelsOfDetail(input);
+  if (!lod)
+  {
+    std::cerr << "Levels of detail were not created\n";
+    return EXIT_FAILURE;
+  }
+  lod->Wait();
+
+  vtkNew<vtkF3DPolyDataMapper> mapper;
+  mapper->SetInputData(input);
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  renderer->GetInformation()->Set(vtkF3DPolyDataMapper::USE_LEVEL_OF_DETAIL(), 1);
+
+  vtkNew<vtkRenderWindow> window;
+  window->SetSize(300, 300);
+  window->OffScreenRenderingOn();
+  window->AddRenderer(renderer);
+
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetFocalPoint(0, 0, 0);
+  camera->SetViewUp(0, 1, 0);
+  camera->SetViewAngle(30);
+  camera->SetClippingRange(0.1, 1000);
+  auto renderAt = [&](double distance)
+  {
+    camera->SetPosition(0, 0, distance);
+    window->Render();
+    return mapper->GetLevelOfDetail();
+  };
+
+  // A far actor is rendered with a coarse level
+  const double farDistance = 100;
+  vtkPolyData* farLevel = renderAt(farDistance);
+  if (!farLevel)
+  {
+    std::cerr << "A far actor is not rendered with a level of detail\n";
+    return EXIT_FAILURE;
+  }
+
+  // Changing the size on screen by less than the hysteresis factor keeps the level
+  const double smallChange = std::sqrt(vtkF3DPolyDataMapper::LevelOfDetailHysteresis) * 0.9;
+  if (renderAt(farDistance / smallChange) != farLevel ||
+    renderAt(farDistance * smallChange) != farLevel || renderAt(farDistance) != farLevel)
+  {
+    std::cerr << "The level of detail changed within the hysteresis factor\n";
+    return EXIT_FAILURE;
+  }
+
+  // A close actor is rendered with a finer level or its full resolution
+  vtkPolyData* closeLevel = renderAt(2);
+  if (closeLevel == farLevel ||
+    (closeLevel && closeLevel->GetNumberOfPolys() <= farLevel->GetNumberOfPolys()))
+  {
+    std::cerr << "A close actor is not rendered with a finer level of detail\n";
+    return EXIT_FAILURE;
+  }
+
+  // Switching between levels does not modify the mapper, which would upload its buffers again
+  const vtkMTimeType mapperMTime = mapper->GetMTime();
+  if (renderAt(farDistance) != farLevel || renderAt(2) != closeLevel ||
+    mapper->GetMTime() != mapperMTime)
+  {
+    std::cerr << "Switching between levels of detail modified the mapper\n";
+    return EXIT_FAILURE;
+  }
+
+  // Without the renderer key, the full resolution is always rendered
+  renderer->GetInformation()->Remove(vtkF3DPolyDataMapper::USE_LEVEL_OF_DETAIL());
+  if (renderAt(farDistance) != nullptr)
+  {
+    std::cerr << "A level of detail is used while it is not enabled\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -5,6 +5,7 @@
 
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DRenderPass.h"
+#include "vtkF3DRenderTargetPool.h"
 #include "vtkF3DTAAPass.h"
 #include "vtkF3DUserRenderPass.h"
 
@@ -51,5 +52,24 @@ int TestF3DRenderPass(int argc, char* argv[])
   // render a second time to check if recompilation skipping is working
   renWin->Render();
 
+  // check that the textures are given back to the pool and reused
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(renderer);
+  pool->Print(std::cout);
+  const size_t nbTextures = pool->GetNumberOfTextures();
+  renWin->Render();
+  if (nbTextures == 0 || pool->GetNumberOfTextures() != nbTextures ||
+    pool->GetAllocatedMemory() == 0)
+  {
+    std::cerr << "Render targets are not reused" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  pool->ReleaseGraphicsResources(renWin);
+  if (pool->GetNumberOfTextures() != 0)
+  {
+    std::cerr << "Render targets are not released" << std::endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
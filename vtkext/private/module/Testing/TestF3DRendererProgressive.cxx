@@ -0,0 +1,81 @@
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderWindowInteractor.h>
+
+#include "vtkF3DMetaImporter.h"
+#include "vtkF3DRenderer.h"
+
+#include <iostream>
+
+int TestF3DRendererProgressive(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkNew<vtkF3DRenderer> renderer;
+  vtkNew<vtkF3DMetaImporter> importer;
+  vtkNew<vtkRenderWindow> window;
+  vtkNew<vtkRenderWindowInteractor> interactor;
+
+  window->AddRenderer(renderer);
+  window->SetInteractor(interactor);
+  window->OffScreenRenderingOn();
+  importer->SetRenderWindow(window);
+  renderer->SetImporter(importer);
+  renderer->Initialize();
+
+  renderer->SetUseSSAOPass(true);
+  renderer->SetUseProgressiveRendering(true);
+  renderer->UpdateActors();
+
+  // Still frames, the frame times are measured one frame late
+  const double stillRate = interactor->GetStillUpdateRate();
+  window->SetDesiredUpdateRate(stillRate);
+  window->Render();
+  window->Render();
+  if (renderer->IsRenderingInteractively())
+  {
+    std::cerr << "Interactive passes used without interaction\n";
+    return EXIT_FAILURE;
+  }
+
+  // Interaction with a frame rate that the full quality passes can hold
+  window->SetDesiredUpdateRate(stillRate * 2);
+  window->Render();
+  if (renderer->IsRenderingInteractively())
+  {
+    std::cerr << "Interactive passes used while the frame rate is held\n";
+    return EXIT_FAILURE;
+  }
+
+  // Interaction with a frame rate that no frame can hold, the chain is degraded and stays
+  // degraded as the interactive frames do not change the measured full quality frame time
+  window->SetDesiredUpdateRate(1e12);
+  for (int i = 0; i < 3; i++)
+  {
+    window->Render();
+    if (!renderer->IsRenderingInteractively())
+    {
+      std::cerr << "Full quality passes used during a slow interaction\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // End of interaction, the full quality chain is restored
+  window->SetDesiredUpdateRate(stillRate);
+  window->Render();
+  if (renderer->IsRenderingInteractively())
+  {
+    std::cerr << "Full quality passes not restored after interaction\n";
+    return EXIT_FAILURE;
+  }
+
+  // Without progressive rendering, the full quality chain is always used
+  renderer->SetUseProgressiveRendering(false);
+  window->SetDesiredUpdateRate(1e12);
+  window->Render();
+  if (renderer->IsRenderingInteractively())
+  {
+    std::cerr << "Interactive passes used without progressive rendering\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+#include <vtkNew.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkShader.h>
+#include <vtkShaderProgram.h>
+#include <vtksys/Directory.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include "vtkF3DExternalRenderWindow.h"
+#include "vtkF3DShaderCache.h"
+
+#include <iostream>
+#include <string>
+
+int TestF3DShaderCache(int vtkNotUsed(argc), char* argv[])
+{
+  // The F3D render windows use the binary shader cache
+  vtkNew<vtkF3DExternalRenderWindow> externalWindow;
+  if (!vtkF3DShaderCache::SafeDownCast(externalWindow->GetShaderCache()))
+  {
+    std::cerr << "vtkF3DExternalRenderWindow does not use a vtkF3DShaderCache\n";
+    return EXIT_FAILURE;
+  }
+
+  // we need an OpenGL context
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->OffScreenRenderingOn();
+  renWin->Start();
+
+  const std::string cachePath = std::string(argv[2]) + "/TestF3DShaderCache";
+  vtksys::SystemTools::RemoveADirectory(cachePath);
+
+  const char* vertexShader = "//VTK::System::Dec\n"
+                             "in vec4 vertexMC;\n"
+                             "void main() { gl_Position = vertexMC; }\n";
+  const char* fragmentShader = "//VTK::System::Dec\n"
+                               "//VTK::Output::Dec\n"
+                               "void main() { gl_FragData[0] = vec4(1.0); }\n";
+
+  // First run, the program is compiled and its binary is written
+  vtkNew<vtkF3DShaderCache> firstCache;
+  firstCache->SetCachePath(cachePath);
+  vtkShaderProgram* program = firstCache->ReadyShaderProgram(vertexShader, fragmentShader, "");
+  if (!program || firstCache->GetNumberOfLoadedBinaries() != 0)
+  {
+    std::cerr << "Unexpected program on the first run\n";
+    return EXIT_FAILURE;
+  }
+  firstCache->ReleaseGraphicsResources(renWin);
+
+  if (firstCache->GetNumberOfSavedBinaries() == 0)
+  {
+    std::cerr << "Program binaries are not supported on this system, skipping the test.\n";
+    return EXIT_SUCCESS;
+  }
+
+  // Second run, with a new cache, the program is created from the binary
+  vtkNew<vtkF3DShaderCache> secondCache;
+  secondCache->SetCachePath(cachePath);
+  program = secondCache->ReadyShaderProgram(vertexShader, fragmentShader, "");
+  if (!program || secondCache->GetNumberOfLoadedBinaries() != 1 ||
+    secondCache->GetNumberOfSavedBinaries() != 0)
+  {
+    std::cerr << "The program binary was not loaded on the second run\n";
+    return EXIT_FAILURE;
+  }
+
+  // The shaders are not compiled when the binary is loaded
+  if (!program->GetCompiled() || program->GetHandle() == 0 ||
+    program->GetVertexShader()->GetHandle() != 0 ||
+    program->GetFragmentShader()->GetHandle() != 0 || !program->IsAttributeUsed("vertexMC"))
+  {
+    std::cerr << "Unexpected state of the program loaded from the binary\n";
+    return EXIT_FAILURE;
+  }
+
+  // The program is released like a program compiled by VTK
+  secondCache->ReleaseGraphicsResources(renWin);
+  if (program->GetHandle() != 0)
+  {
+    std::cerr << "The program loaded from the binary was not released\n";
+    return EXIT_FAILURE;
+  }
+
+  // A cache without room evicts every binary, including the one just written
+  vtkNew<vtkF3DShaderCache> thirdCache;
+  thirdCache->SetCachePath(cachePath);
+  thirdCache->SetMaximumCacheSize(0);
+  program = thirdCache->ReadyShaderProgram(vertexShader,
+    "//VTK::System::Dec\n"
+    "//VTK::Output::Dec\n"
+    "void main() { gl_FragData[0] = vec4(0.5); }\n",
+    "");
+  if (!program || thirdCache->GetNumberOfSavedBinaries() != 1)
+  {
+    std::cerr << "The program binary was not written on the third run\n";
+    return EXIT_FAILURE;
+  }
+  thirdCache->ReleaseGraphicsResources(renWin);
+
+  vtksys::Directory cacheDirectory;
+  cacheDirectory.Load(cachePath);
+  for (unsigned long i = 0; i < cacheDirectory.GetNumberOfFiles(); i++)
+  {
+    if (vtksys::SystemTools::GetFilenameLastExtension(cacheDirectory.GetFile(i)) == ".bin")
+    {
+      std::cerr << "The program binaries were not evicted from the cache\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,5 +1,7 @@
 #include "vtkF3DDisplayDepthRenderPass.h"
 
+#include "vtkF3DRenderTargetPool.h"
+
 #include <vtkDiscretizableColorTransferFunction.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLError.h>
@@ -36,7 +38,13 @@ void vtkF3DDisplayDepthRenderPass::Render(const vtkRenderState* state)
   int size[2];
   renderer->GetTiledSizeAndOrigin(&size[0], &size[1], &pos[0], &pos[1]);
 
-  this->InitializeResources(renWin, size[0], size[1]);
+  this->InitializeResources(renWin);
+
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(renderer);
+  this->ColorTexture =
+    pool->Acquire(renWin, size[0], size[1], vtkF3DRenderTargetPool::Format::RGBA8);
+  this->DepthTexture =
+    pool->Acquire(renWin, size[0], size[1], vtkF3DRenderTargetPool::Format::Depth32F);
 
   // render to color and depth texture
   renWin->GetState()->PushFramebufferBindings();
@@ -94,35 +102,16 @@ void vtkF3DDisplayDepthRenderPass::Render(const vtkRenderState* state)
   this->ColorTexture->Deactivate();
   this->DepthTexture->Deactivate();
   this->ColorMapTexture->Deactivate();
+  pool->Release(this->ColorTexture);
+  pool->Release(this->DepthTexture);
+  this->ColorTexture = nullptr;
+  this->DepthTexture = nullptr;
   vtkOpenGLCheckErrorMacro("failed after Render");
 }
 
 //------------------------------------------------------------------------------
-void vtkF3DDisplayDepthRenderPass::InitializeResources(vtkOpenGLRenderWindow* renWin, int w, int h)
+void vtkF3DDisplayDepthRenderPass::InitializeResources(vtkOpenGLRenderWindow* renWin)
 {
-  if (this->DepthTexture == nullptr)
-  {
-    this->DepthTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->DepthTexture->SetContext(renWin);
-    this->DepthTexture->AllocateDepth(w, h, vtkTextureObject::Float32);
-  }
-  this->DepthTexture->Resize(w, h);
-
-  if (this->ColorTexture == nullptr)
-  {
-    this->ColorTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->ColorTexture->SetContext(renWin);
-    this->ColorTexture->SetFormat(GL_RGBA);
-    this->ColorTexture->SetInternalFormat(GL_RGBA8);
-    this->ColorTexture->SetDataType(GL_UNSIGNED_BYTE);
-    this->ColorTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->Allocate2D(w, h, 4, VTK_UNSIGNED_CHAR);
-  }
-  this->ColorTexture->Resize(w, h);
-
   if (this->ColorMapTexture == nullptr)
   {
     this->ColorMapTexture = vtkSmartPointer<vtkTextureObject>::New();
@@ -169,14 +158,6 @@ void vtkF3DDisplayDepthRenderPass::ReleaseGraphicsResources(vtkWindow* window)
   {
     this->FrameBufferObject->ReleaseGraphicsResources(window);
   }
-  if (this->ColorTexture)
-  {
-    this->ColorTexture->ReleaseGraphicsResources(window);
-  }
-  if (this->DepthTexture)
-  {
-    this->DepthTexture->ReleaseGraphicsResources(window);
-  }
   if (this->ColorMapTexture)
   {
     this->ColorMapTexture->ReleaseGraphicsResources(window);
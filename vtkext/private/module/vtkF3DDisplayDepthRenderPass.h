@@ -34,7 +34,7 @@ private:
   vtkF3DDisplayDepthRenderPass() = default;
   ~vtkF3DDisplayDepthRenderPass() override = default;
 
-  void InitializeResources(vtkOpenGLRenderWindow* renWin, int w, int h);
+  void InitializeResources(vtkOpenGLRenderWindow* renWin);
 
   vtkSmartPointer<vtkDiscretizableColorTransferFunction> ColorMap;
   vtkTimeStamp ColorMapBuildTime;
@@ -4,9 +4,13 @@
 #include <vtkglad/include/glad/egl.h>
 
 #include "vtkF3DEGLRenderWindow.h"
+#include "vtkF3DShaderCache.h"
 
 //------------------------------------------------------------------------------
-vtkF3DEGLRenderWindow::vtkF3DEGLRenderWindow() = default;
+vtkF3DEGLRenderWindow::vtkF3DEGLRenderWindow()
+{
+  vtkF3DShaderCache::Install(this->ShaderCache);
+}
 
 //------------------------------------------------------------------------------
 vtkF3DEGLRenderWindow::~vtkF3DEGLRenderWindow() = default;
@@ -7,11 +7,16 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkVersion.h"
 
-#include <ImfArray.h>
+#include <ImfChannelList.h>
+#include <ImfFrameBuffer.h>
+#include <ImfHeader.h>
 #include <ImfIO.h>
-#include <ImfRgbaFile.h>
+#include <ImfInputFile.h>
+#include <ImfThreading.h>
+#include <ImfTiledInputFile.h>
 #include <ImfVersion.h>
 
 #include <algorithm>
@@ -65,6 +70,40 @@ private:
   uint64_t Pos = 0;
 };
 
+namespace
+{
+/**
+ * Call the provided function with the source of the reader, either a memory stream or a file name,
+ * that can be used to construct an OpenEXR file.
+ */
+template<typename F>
+void ReadSource(vtkF3DEXRReader* reader, const char* fileName, F&& function)
+{
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  if (reader->GetStream())
+  {
+    // F3D only uses stream from memory
+    vtkMemoryResourceStream* stream = vtkMemoryResourceStream::SafeDownCast(reader->GetStream());
+    assert(stream);
+
+    MemStream memoryStream("EXRmemoryStream", stream->GetBuffer(), stream->GetSize());
+    function(memoryStream);
+  }
+#else
+  if (reader->GetMemoryBuffer())
+  {
+    MemStream memoryStream(
+      "EXRmemoryStream", reader->GetMemoryBuffer(), reader->GetMemoryBufferLength());
+    function(memoryStream);
+  }
+#endif
+  else
+  {
+    function(fileName);
+  }
+}
+}
+
 vtkStandardNewMacro(vtkF3DEXRReader);
 
 //------------------------------------------------------------------------------
@@ -77,6 +116,8 @@ vtkF3DEXRReader::~vtkF3DEXRReader() = default;
 void vtkF3DEXRReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaximumWidth: " << this->MaximumWidth << "\n";
+  os << indent << "Level: " << this->Level << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -100,47 +141,56 @@ void vtkF3DEXRReader::ExecuteInformation()
     }
   }
 
-  auto checkChannels = [&](Imf::RgbaInputFile& file)
+  auto readHeader = [&](auto& source)
   {
-    Imath::Box2i dw = file.dataWindow();
+    Imf::InputFile file(source);
+    const Imf::Header& header = file.header();
+    const Imf::ChannelList& channels = header.channels();
+    if (!channels.findChannel("R") || !channels.findChannel("G") || !channels.findChannel("B"))
+    {
+      throw std::runtime_error("only RGB and RGBA channels are supported");
+    }
+
+    Imath::Box2i dw = header.dataWindow();
     this->DataExtent[0] = dw.min.x;
     this->DataExtent[1] = dw.max.x;
     this->DataExtent[2] = dw.min.y;
     this->DataExtent[3] = dw.max.y;
 
-    Imf::RgbaChannels channels = file.channels();
-    if (channels != Imf::RgbaChannels::WRITE_RGBA && channels != Imf::RgbaChannels::WRITE_RGB)
+    this->Level = 0;
+    return this->MaximumWidth > 0 && this->GetWidth() > this->MaximumWidth &&
+      header.hasTileDescription() && header.tileDescription().mode == Imf::MIPMAP_LEVELS;
+  };
+
+  // Select the finest mipmap level fitting in the maximum width, or the coarsest one
+  auto selectLevel = [&](auto& source)
+  {
+    Imf::TiledInputFile file(source);
+    this->Level = file.numLevels() - 1;
+    for (int level = 0; level < file.numLevels(); level++)
     {
-      throw std::runtime_error("only RGB and RGBA channels are supported");
+      if (file.levelWidth(level) <= this->MaximumWidth)
+      {
+        this->Level = level;
+        break;
+      }
     }
+
+    Imath::Box2i dw = file.dataWindowForLevel(this->Level);
+    this->DataExtent[0] = dw.min.x;
+    this->DataExtent[1] = dw.max.x;
+    this->DataExtent[2] = dw.min.y;
+    this->DataExtent[3] = dw.max.y;
   };
 
   try
   {
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-    if (this->GetStream())
+    bool hasLevels = false;
+    ::ReadSource(this, this->InternalFileName,
+      [&](auto& source) { hasLevels = readHeader(source); });
+    if (hasLevels)
     {
-      // F3D only uses stream from memory
-      vtkMemoryResourceStream* stream = vtkMemoryResourceStream::SafeDownCast(this->GetStream());
-      assert(stream);
-
-      MemStream memoryStream("EXRmemoryStream", stream->GetBuffer(), stream->GetSize());
-      Imf::RgbaInputFile file = Imf::RgbaInputFile(memoryStream);
-      checkChannels(file);
-    }
-#else
-    if (this->GetMemoryBuffer())
-    {
-      MemStream memoryStream(
-        "EXRmemoryStream", this->GetMemoryBuffer(), this->GetMemoryBufferLength());
-      Imf::RgbaInputFile file = Imf::RgbaInputFile(memoryStream);
-      checkChannels(file);
-    }
-#endif
-    else
-    {
-      Imf::RgbaInputFile file(this->InternalFileName);
-      checkChannels(file);
+      ::ReadSource(this, this->InternalFileName, selectLevel);
     }
   }
   catch (const std::exception& e)
@@ -206,60 +256,65 @@ void vtkF3DEXRReader::ExecuteDataWithInformation(vtkDataObject* output, vtkInfor
   scalars->SetName("Pixels");
   float* dataPtr = scalars->GetPointer(0);
 
-  auto readContent = [&](Imf::RgbaInputFile& file)
+  // Decode the channels directly in the output, as float whatever their type in the file
+  auto readContent = [&](auto& source)
   {
-    Imf::Array2D<Imf::Rgba> pixels(this->GetHeight(), this->GetWidth());
+    const Imath::Box2i dw(Imath::V2i(this->DataExtent[0], this->DataExtent[2]),
+      Imath::V2i(this->DataExtent[1], this->DataExtent[3]));
 
-    file.setFrameBuffer(&pixels[0][0], 1, this->GetWidth());
-    file.readPixels(this->DataExtent[2], this->DataExtent[3]);
-
-    for (int y = this->GetHeight() - 1; y >= 0; y--)
+    Imf::FrameBuffer frameBuffer;
+    const char* names[] = { "R", "G", "B" };
+    for (int c = 0; c < 3; c++)
     {
-      for (int x = 0; x < this->GetWidth(); x++)
-      {
-        const Imf::Rgba& p = pixels[y][x];
-        dataPtr[0] = std::clamp(static_cast<float>(p.r), 0.f, 10000.f);
-        dataPtr[1] = std::clamp(static_cast<float>(p.g), 0.f, 10000.f);
-        dataPtr[2] = std::clamp(static_cast<float>(p.b), 0.f, 10000.f);
-        dataPtr += 3;
-      }
+      frameBuffer.insert(
+        names[c], Imf::Slice::Make(Imf::FLOAT, dataPtr + c, dw, 3 * sizeof(float)));
     }
-  };
-
-  try
-  {
-    Imf::setGlobalThreadCount(std::thread::hardware_concurrency());
 
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-    if (this->GetStream())
-    {
-      // F3D only uses stream from memory
-      vtkMemoryResourceStream* stream = vtkMemoryResourceStream::SafeDownCast(this->GetStream());
-      assert(stream);
-
-      MemStream memoryStream("EXRmemoryStream", stream->GetBuffer(), stream->GetSize());
-      Imf::RgbaInputFile file = Imf::RgbaInputFile(memoryStream);
-      readContent(file);
-    }
-#else
-    if (this->GetMemoryBuffer())
+    if (this->Level > 0)
     {
-      MemStream memoryStream(
-        "EXRmemoryStream", this->GetMemoryBuffer(), this->GetMemoryBufferLength());
-      Imf::RgbaInputFile file = Imf::RgbaInputFile(memoryStream);
-      readContent(file);
+      Imf::TiledInputFile file(source);
+      file.setFrameBuffer(frameBuffer);
+      file.readTiles(
+        0, file.numXTiles(this->Level) - 1, 0, file.numYTiles(this->Level) - 1, this->Level);
     }
-#endif
     else
     {
-      Imf::RgbaInputFile file(this->InternalFileName);
-      readContent(file);
+      Imf::InputFile file(source);
+      file.setFrameBuffer(frameBuffer);
+      file.readPixels(dw.min.y, dw.max.y);
     }
+  };
+
+  try
+  {
+    Imf::setGlobalThreadCount(std::thread::hardware_concurrency());
+    ::ReadSource(this, this->InternalFileName, readContent);
   }
   catch (const std::exception& e)
   {
     vtkErrorMacro("Error reading EXR file: " << e.what());
+    return;
   }
+
+  // EXR images start at the top, flip the rows in place while clamping the values
+  const int width = this->GetWidth();
+  const int height = this->GetHeight();
+  vtkSMPTools::For(0, (height + 1) / 2,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      auto clampValue = [](float value) { return std::clamp(value, 0.f, 10000.f); };
+      for (vtkIdType y = begin; y < end; y++)
+      {
+        float* top = dataPtr + 3 * width * y;
+        float* bottom = dataPtr + 3 * width * (height - 1 - y);
+        for (int i = 0; i < 3 * width; i++)
+        {
+          const float value = clampValue(top[i]);
+          top[i] = clampValue(bottom[i]);
+          bottom[i] = value;
+        }
+      }
+    });
 }
 
 //------------------------------------------------------------------------------
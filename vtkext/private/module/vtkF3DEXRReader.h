@@ -44,6 +44,22 @@ public:
     return "OpenEXR";
   }
 
+  ///@{
+  /**
+   * Set/Get the maximum width of the output image, 0 meaning no maximum.
+   * If the file is tiled with mipmap levels, the finest level not wider than this is read.
+   * Other files are always read at full resolution.
+   * Default is 0.
+   */
+  vtkSetMacro(MaximumWidth, int);
+  vtkGetMacro(MaximumWidth, int);
+  ///@}
+
+  /**
+   * Get the mipmap level of the file read by the last update, 0 being the full resolution.
+   */
+  vtkGetMacro(Level, int);
+
 protected:
   vtkF3DEXRReader();
   ~vtkF3DEXRReader() override;
@@ -54,6 +70,9 @@ protected:
   int GetWidth() const;
   int GetHeight() const;
 
+  int MaximumWidth = 0;
+  int Level = 0;
+
 private:
   vtkF3DEXRReader(const vtkF3DEXRReader&) = delete;
   void operator=(const vtkF3DEXRReader&) = delete;
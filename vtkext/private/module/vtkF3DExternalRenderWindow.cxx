@@ -5,6 +5,7 @@
 #include <vtk_glad.h>
 
 #include "vtkF3DExternalRenderWindow.h"
+#include "vtkF3DShaderCache.h"
 
 vtkStandardNewMacro(vtkF3DExternalRenderWindow);
 
@@ -12,6 +13,7 @@ vtkStandardNewMacro(vtkF3DExternalRenderWindow);
 vtkF3DExternalRenderWindow::vtkF3DExternalRenderWindow()
 {
   this->FrameBlitMode = BlitToCurrent;
+  vtkF3DShaderCache::Install(this->ShaderCache);
 }
 
 //------------------------------------------------------------------------------
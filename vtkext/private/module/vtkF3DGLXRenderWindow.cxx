@@ -4,6 +4,7 @@
 #include <vtkglad/include/glad/glx.h>
 
 #include "vtkF3DGLXRenderWindow.h"
+#include "vtkF3DShaderCache.h"
 
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251009)
 #include "vtkX11Functions.h"
@@ -12,7 +13,10 @@
 #endif
 
 //------------------------------------------------------------------------------
-vtkF3DGLXRenderWindow::vtkF3DGLXRenderWindow() = default;
+vtkF3DGLXRenderWindow::vtkF3DGLXRenderWindow()
+{
+  vtkF3DShaderCache::Install(this->ShaderCache);
+}
 
 //------------------------------------------------------------------------------
 vtkF3DGLXRenderWindow::~vtkF3DGLXRenderWindow() = default;
@@ -1,5 +1,6 @@
 #include "vtkF3DHexagonalBokehBlurPass.h"
 
+#include "vtkF3DRenderTargetPool.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLError.h"
 #include "vtkOpenGLFramebufferObject.h"
@@ -65,51 +66,8 @@ void vtkF3DHexagonalBokehBlurPass::PrintSelf(ostream& os, vtkIndent indent)
 }
 
 //------------------------------------------------------------------------------
-void vtkF3DHexagonalBokehBlurPass::InitializeGraphicsResources(
-  vtkOpenGLRenderWindow* renWin, int width, int height)
+void vtkF3DHexagonalBokehBlurPass::InitializeGraphicsResources(vtkOpenGLRenderWindow* renWin)
 {
-  if (this->BackgroundTexture == nullptr)
-  {
-    this->BackgroundTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->BackgroundTexture->SetContext(renWin);
-    this->BackgroundTexture->SetFormat(GL_RGB);
-    this->BackgroundTexture->SetInternalFormat(GL_RGB16F);
-    this->BackgroundTexture->SetDataType(GL_HALF_FLOAT);
-    this->BackgroundTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->BackgroundTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->BackgroundTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->BackgroundTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->BackgroundTexture->Allocate2D(width, height, 3, VTK_FLOAT);
-  }
-
-  if (this->VerticalBlurTexture == nullptr)
-  {
-    this->VerticalBlurTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->VerticalBlurTexture->SetContext(renWin);
-    this->VerticalBlurTexture->SetFormat(GL_RGB);
-    this->VerticalBlurTexture->SetInternalFormat(GL_RGB16F);
-    this->VerticalBlurTexture->SetDataType(GL_HALF_FLOAT);
-    this->VerticalBlurTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->VerticalBlurTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->VerticalBlurTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->VerticalBlurTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->VerticalBlurTexture->Allocate2D(width, height, 3, VTK_FLOAT);
-  }
-
-  if (this->DiagonalBlurTexture == nullptr)
-  {
-    this->DiagonalBlurTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->DiagonalBlurTexture->SetContext(renWin);
-    this->DiagonalBlurTexture->SetFormat(GL_RGB);
-    this->DiagonalBlurTexture->SetInternalFormat(GL_RGB16F);
-    this->DiagonalBlurTexture->SetDataType(GL_HALF_FLOAT);
-    this->DiagonalBlurTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->DiagonalBlurTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->DiagonalBlurTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->DiagonalBlurTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->DiagonalBlurTexture->Allocate2D(width, height, 3, VTK_FLOAT);
-  }
-
   if (this->FrameBufferObject == nullptr)
   {
     this->FrameBufferObject = vtkSmartPointer<vtkOpenGLFramebufferObject>::New();
@@ -265,7 +223,8 @@ void vtkF3DHexagonalBokehBlurPass::RenderRhomboidBlur(
 
   this->RhomboidQuadHelper->Render();
 
-  this->BackgroundTexture->Deactivate();
+  this->VerticalBlurTexture->Deactivate();
+  this->DiagonalBlurTexture->Deactivate();
 }
 
 //------------------------------------------------------------------------------
@@ -296,11 +255,10 @@ void vtkF3DHexagonalBokehBlurPass::Render(const vtkRenderState* s)
     r->GetTiledSizeAndOrigin(&w, &h, &x, &y);
   }
 
-  this->InitializeGraphicsResources(renWin, w, h);
+  this->InitializeGraphicsResources(renWin);
 
-  this->BackgroundTexture->Resize(w, h);
-  this->VerticalBlurTexture->Resize(w, h);
-  this->DiagonalBlurTexture->Resize(w, h);
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(r);
+  this->BackgroundTexture = pool->Acquire(renWin, w, h, vtkF3DRenderTargetPool::Format::RGB16F);
 
   ostate->vtkglViewport(x, y, w, h);
   ostate->vtkglScissor(x, y, w, h);
@@ -310,8 +268,18 @@ void vtkF3DHexagonalBokehBlurPass::Render(const vtkRenderState* s)
   ostate->vtkglDisable(GL_BLEND);
   ostate->vtkglDisable(GL_DEPTH_TEST);
 
+  // The background is only read by the directional blur, give it back to the pool right after
+  this->VerticalBlurTexture = pool->Acquire(renWin, w, h, vtkF3DRenderTargetPool::Format::RGB16F);
+  this->DiagonalBlurTexture = pool->Acquire(renWin, w, h, vtkF3DRenderTargetPool::Format::RGB16F);
   this->RenderDirectionalBlur(renWin, w, h);
+  pool->Release(this->BackgroundTexture);
+  this->BackgroundTexture = nullptr;
+
   this->RenderRhomboidBlur(renWin, w, h);
+  pool->Release(this->VerticalBlurTexture);
+  pool->Release(this->DiagonalBlurTexture);
+  this->VerticalBlurTexture = nullptr;
+  this->DiagonalBlurTexture = nullptr;
 
   vtkOpenGLCheckErrorMacro("failed after Render");
 }
@@ -337,7 +305,4 @@ void vtkF3DHexagonalBokehBlurPass::ReleaseGraphicsResources(vtkWindow* win)
   }
 
   this->FrameBufferObject = nullptr;
-  this->DiagonalBlurTexture = nullptr;
-  this->VerticalBlurTexture = nullptr;
-  this->BackgroundTexture = nullptr;
 }
@@ -60,7 +60,7 @@ protected:
   /**
    * Initialize graphics resources.
    */
-  void InitializeGraphicsResources(vtkOpenGLRenderWindow* renWin, int width, int height);
+  void InitializeGraphicsResources(vtkOpenGLRenderWindow* renWin);
 
   /**
    * Render delegate pass.
@@ -78,7 +78,7 @@ protected:
   void RenderRhomboidBlur(vtkOpenGLRenderWindow* renWin, int width, int height);
 
   /**
-   * Graphics resources.
+   * Graphics resources, textures are acquired from the render target pool during Render.
    */
   vtkSmartPointer<vtkOpenGLFramebufferObject> FrameBufferObject;
   vtkSmartPointer<vtkTextureObject> VerticalBlurTexture;
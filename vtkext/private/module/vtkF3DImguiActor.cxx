@@ -1100,6 +1100,11 @@ void vtkF3DImguiActor::RenderFpsCounter()
 
   std::string fpsString = std::to_string(this->FpsValue);
   fpsString += " fps";
+  if (this->CulledProps > 0)
+  {
+    fpsString += "\n" + std::to_string(this->TotalProps - this->CulledProps) + "/" +
+      std::to_string(this->TotalProps) + " props";
+  }
 
   ImVec2 winSize = ImGui::CalcTextSize(fpsString.c_str());
   winSize.x += 2.f * ImGui::GetStyle().WindowPadding.x;
@@ -201,7 +201,8 @@ bool vtkF3DImguiObserver::MouseMove(vtkObject* caller, unsigned long, void*)
     ImGuiIO& io = ImGui::GetIO();
     io.AddMousePosEvent(static_cast<float>(p[0]), static_cast<float>(sz[1] - p[1] - 1));
     // RenderUI is not called here on purpose to avoid too frequent UI draw
-    // The event loop is taking care of it
+    // The event loop is taking care of it, flag that there is something to draw
+    this->Modified();
     return io.WantCaptureMouse;
   }
   return false;
@@ -216,6 +217,7 @@ bool vtkF3DImguiObserver::MouseLeave(vtkObject*, unsigned long, void*)
     // hover tooltip) clears instead of sticking at the last in-window position.
     constexpr float offscreen = -std::numeric_limits<float>::max();
     ImGui::GetIO().AddMousePosEvent(offscreen, offscreen);
+    this->Modified();
   }
   return false;
 }
@@ -0,0 +1,380 @@
+#include "vtkF3DMeshLOD.h"
+
+#include "F3DLog.h"
+
+#include <vtkCellArray.h>
+#include <vtkCellArrayIterator.h>
+#include <vtkCellData.h>
+#include <vtkFieldData.h>
+#include <vtkIdList.h>
+#include <vtkInformation.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+// Maximum number of levels, excluding the full resolution
+constexpr int MaxNumberOfLevels = 4;
+
+// Ratio between the number of cells of two consecutive levels
+constexpr double LevelReduction = 4.0;
+
+// Levels with fewer cells than this are not built
+constexpr double MinimumLevelCells = 10000;
+
+// Maximum number of bins along an axis, so a bin index fits in 64 bits
+constexpr double MaxBinsPerAxis = 1 << 20;
+
+//----------------------------------------------------------------------------
+// Cluster the points of the polygons of the input in a regular grid of bins of the provided
+// size, keeping the first point of each bin as its representative, and drop the triangles
+// collapsed by the clustering. Only the bins actually containing points are stored.
+// Return nullptr if aborted.
+vtkSmartPointer<vtkPolyData> ClusterPoints(vtkPolyData* input, const std::array<double, 6>& bounds,
+  double binSize, const std::atomic<bool>& abort)
+{
+  std::array<std::uint64_t, 3> dims;
+  for (int axis = 0; axis < 3; axis++)
+  {
+    const double extent = bounds[2 * axis + 1] - bounds[2 * axis];
+    dims[axis] = static_cast<std::uint64_t>(
+      std::clamp(std::ceil(extent / binSize), 1.0, ::MaxBinsPerAxis));
+  }
+
+  vtkPoints* inPoints = input->GetPoints();
+  std::vector<vtkIdType> pointMap(input->GetNumberOfPoints(), -1);
+  std::unordered_map<std::uint64_t, vtkIdType> bins;
+  bins.reserve(input->GetNumberOfPoints() / 4);
+  vtkNew<vtkIdList> sourcePoints;
+
+  auto mapPoint = [&](vtkIdType pointId)
+  {
+    vtkIdType& mapped = pointMap[pointId];
+    if (mapped < 0)
+    {
+      double p[3];
+      inPoints->GetPoint(pointId, p);
+      std::uint64_t key = 0;
+      for (int axis = 0; axis < 3; axis++)
+      {
+        const double index = std::floor((p[axis] - bounds[2 * axis]) / binSize);
+        key = key * dims[axis] +
+          std::min(static_cast<std::uint64_t>(std::max(index, 0.0)), dims[axis] - 1);
+      }
+      auto inserted = bins.emplace(key, sourcePoints->GetNumberOfIds());
+      if (inserted.second)
+      {
+        sourcePoints->InsertNextId(pointId);
+      }
+      mapped = inserted.first->second;
+    }
+    return mapped;
+  };
+
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIdList> sourceCells;
+  auto insertTriangle = [&](vtkIdType a, vtkIdType b, vtkIdType c, vtkIdType cellId)
+  {
+    const vtkIdType triangle[3] = { mapPoint(a), mapPoint(b), mapPoint(c) };
+    if (triangle[0] != triangle[1] && triangle[1] != triangle[2] && triangle[2] != triangle[0])
+    {
+      polys->InsertNextCell(3, triangle);
+      sourceCells->InsertNextId(cellId);
+    }
+  };
+
+  // Polygons are triangulated as fans and strips are split, the cells are iterated with
+  // iterators as the cell arrays are shared with the rendered input.
+  vtkIdType cellId = input->GetNumberOfVerts() + input->GetNumberOfLines();
+  for (vtkCellArray* cells : { input->GetPolys(), input->GetStrips() })
+  {
+    const bool strips = cells == input->GetStrips();
+    auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+    for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell(), cellId++)
+    {
+      if ((cellId & 0xffff) == 0 && abort)
+      {
+        return nullptr;
+      }
+
+      vtkIdType npts;
+      const vtkIdType* pts;
+      iter->GetCurrentCell(npts, pts);
+      for (vtkIdType i = 2; i < npts; i++)
+      {
+        if (!strips)
+        {
+          insertTriangle(pts[0], pts[i - 1], pts[i], cellId);
+        }
+        else if (i % 2 == 0)
+        {
+          insertTriangle(pts[i - 2], pts[i - 1], pts[i], cellId);
+        }
+        else
+        {
+          insertTriangle(pts[i - 1], pts[i - 2], pts[i], cellId);
+        }
+      }
+    }
+  }
+
+  const vtkIdType nbPoints = sourcePoints->GetNumberOfIds();
+  vtkNew<vtkPoints> points;
+  points->SetDataType(inPoints->GetDataType());
+  points->SetNumberOfPoints(nbPoints);
+  inPoints->GetData()->GetTuples(sourcePoints, points->GetData());
+
+  vtkSmartPointer<vtkPolyData> output = vtkSmartPointer<vtkPolyData>::New();
+  output->SetPoints(points);
+  output->SetPolys(polys);
+
+  // Copy the attributes of the representative points and of the source cells
+  auto copyData = [](vtkDataSetAttributes* in, vtkDataSetAttributes* out, vtkIdList* source)
+  {
+    vtkNew<vtkIdList> destination;
+    destination->SetNumberOfIds(source->GetNumberOfIds());
+    std::iota(destination->begin(), destination->end(), 0);
+    out->CopyAllocate(in, source->GetNumberOfIds());
+    out->CopyData(in, source, destination);
+  };
+  copyData(input->GetPointData(), output->GetPointData(), sourcePoints);
+  copyData(input->GetCellData(), output->GetCellData(), sourceCells);
+
+  output->GetFieldData()->ShallowCopy(input->GetFieldData());
+  return output;
+}
+}
+
+vtkStandardNewMacro(vtkF3DMeshLOD);
+vtkInformationKeyMacro(vtkF3DMeshLOD, LEVELS_OF_DETAIL, ObjectBase);
+
+//----------------------------------------------------------------------------
+vtkF3DMeshLOD::~vtkF3DMeshLOD()
+{
+  // Stop building the remaining levels
+  this->Abort = true;
+  if (this->Future.valid())
+  {
+    this->Future.wait();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMeshLOD::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "InputNumberOfCells: " << this->InputNumberOfCells << "\n";
+  os << indent << "NumberOfLevels: " << this->BuiltLevels.size() << "\n";
+}
+
+//----------------------------------------------------------------------------
+vtkF3DMeshLOD* vtkF3DMeshLOD::GetLevelsOfDetail(vtkPolyData* input, vtkIdType minimumNumberOfCells)
+{
+  // Vertices and lines are not decimated
+  if (!input || input->GetNumberOfVerts() > 0 || input->GetNumberOfLines() > 0 ||
+    input->GetNumberOfPolys() + input->GetNumberOfStrips() < minimumNumberOfCells)
+  {
+    return nullptr;
+  }
+
+  vtkInformation* info = input->GetInformation();
+  vtkF3DMeshLOD* lod = vtkF3DMeshLOD::SafeDownCast(info->Get(vtkF3DMeshLOD::LEVELS_OF_DETAIL()));
+  if (lod && lod->InputAnimated)
+  {
+    return nullptr;
+  }
+
+  if (lod && lod->InputMTime < input->GetMTime() && lod->Future.valid())
+  {
+    // The input was modified again before its levels were built and used, it is most likely
+    // animated and rebuilding its levels at every frame would never complete, so it is always
+    // rendered at full resolution
+    lod->Abort = true;
+    lod->InputAnimated = true;
+    return nullptr;
+  }
+
+  if (!lod || lod->InputMTime < input->GetMTime())
+  {
+    vtkNew<vtkF3DMeshLOD> newLod;
+    newLod->Build(input);
+    info->Set(vtkF3DMeshLOD::LEVELS_OF_DETAIL(), newLod);
+    newLod->InputMTime = input->GetMTime();
+    lod = newLod;
+  }
+  return lod;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMeshLOD::Build(vtkPolyData* input)
+{
+  this->InputNumberOfCells = input->GetNumberOfPolys() + input->GetNumberOfStrips();
+
+  // The build works on a shallow copy holding references to the points, cells and arrays of
+  // the input, so they stay valid if the input is modified during the build.
+  // The bounds are computed here as computing them caches them in the shared points.
+  input->GetBounds();
+  vtkSmartPointer<vtkPolyData> copy = vtkSmartPointer<vtkPolyData>::New();
+  copy->ShallowCopy(input);
+
+  this->Future = std::async(std::launch::async, &vtkF3DMeshLOD::BuildLevels, copy,
+    std::cref(this->Abort));
+}
+
+//----------------------------------------------------------------------------
+vtkF3DMeshLOD::Levels vtkF3DMeshLOD::BuildLevels(
+  vtkSmartPointer<vtkPolyData> input, const std::atomic<bool>& abort)
+{
+  Levels levels;
+
+  std::array<double, 6> bounds;
+  input->GetPoints()->GetBounds(bounds.data());
+  const double dx = bounds[1] - bounds[0];
+  const double dy = bounds[3] - bounds[2];
+  const double dz = bounds[5] - bounds[4];
+  const double halfArea = dx * dy + dy * dz + dz * dx;
+  if (halfArea <= 0.0)
+  {
+    return levels;
+  }
+
+  // The number of cells of a level is about twice the number of bins crossed by the surface,
+  // which is inversely proportional to the square of the bin size. The first bin size is
+  // estimated from the area of the bounding box and the next ones from the previous level.
+  const double numberOfCells =
+    static_cast<double>(input->GetNumberOfPolys() + input->GetNumberOfStrips());
+  vtkSmartPointer<vtkPolyData> source = input;
+  double sourceCells = numberOfCells;
+  double previousCells = numberOfCells;
+  double binSize = 0.0;
+  for (int level = 1; level <= ::MaxNumberOfLevels && !abort; level++)
+  {
+    const double target = numberOfCells / std::pow(::LevelReduction, level);
+    if (target < ::MinimumLevelCells)
+    {
+      break;
+    }
+
+    binSize = level == 1 ? std::sqrt(2.0 * halfArea / target)
+                         : binSize * std::sqrt(previousCells / target);
+    vtkSmartPointer<vtkPolyData> output = ::ClusterPoints(source, bounds, binSize, abort);
+    if (!output)
+    {
+      break;
+    }
+
+    // Only keep levels significantly coarser than the previous one
+    previousCells = static_cast<double>(output->GetNumberOfPolys());
+    if (previousCells < 0.75 * sourceCells)
+    {
+      levels.push_back(output);
+      source = output;
+      sourceCells = previousCells;
+    }
+  }
+  return levels;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMeshLOD::Poll()
+{
+  using namespace std::chrono_literals;
+  if (!this->Future.valid() || this->Future.wait_for(0s) != std::future_status::ready)
+  {
+    return;
+  }
+
+  this->BuiltLevels = this->Future.get();
+
+  std::string message = "Built " + std::to_string(this->BuiltLevels.size()) +
+    " levels of detail for a mesh of " + std::to_string(this->InputNumberOfCells) + " cells";
+  for (size_t i = 0; i < this->BuiltLevels.size(); i++)
+  {
+    message += (i == 0 ? ": " : ", ") + std::to_string(this->BuiltLevels[i]->GetNumberOfPolys());
+  }
+  F3DLog::Print(F3DLog::Severity::Debug, message);
+}
+
+//----------------------------------------------------------------------------
+vtkPolyData* vtkF3DMeshLOD::SelectLevel(double numberOfCells)
+{
+  this->Poll();
+
+  for (auto it = this->BuiltLevels.rbegin(); it != this->BuiltLevels.rend(); ++it)
+  {
+    if ((*it)->GetNumberOfPolys() >= numberOfCells)
+    {
+      return *it;
+    }
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+vtkPolyData* vtkF3DMeshLOD::SelectLevel(
+  double numberOfCells, vtkPolyData* current, double hysteresis)
+{
+  vtkPolyData* selected = this->SelectLevel(numberOfCells);
+  if (selected == current ||
+    (current &&
+      std::find(this->BuiltLevels.begin(), this->BuiltLevels.end(), current) ==
+        this->BuiltLevels.end()))
+  {
+    return selected;
+  }
+
+  // Levels are sorted from the finest to the coarsest, the full resolution being the finest
+  auto rank = [&](vtkPolyData* level)
+  {
+    return level ? std::distance(this->BuiltLevels.begin(),
+                     std::find(this->BuiltLevels.begin(), this->BuiltLevels.end(), level)) + 1
+                 : 0;
+  };
+  const auto currentRank = rank(current);
+  if (currentRank >= rank(this->SelectLevel(numberOfCells * hysteresis)) &&
+    currentRank <= rank(this->SelectLevel(numberOfCells / hysteresis)))
+  {
+    return current;
+  }
+  return selected;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMeshLOD::Wait()
+{
+  if (this->Future.valid())
+  {
+    this->Future.wait();
+  }
+  this->Poll();
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DMeshLOD::GetNumberOfLevels()
+{
+  this->Poll();
+  return static_cast<int>(this->BuiltLevels.size());
+}
+
+//----------------------------------------------------------------------------
+vtkPolyData* vtkF3DMeshLOD::GetLevel(int index)
+{
+  this->Poll();
+  return index >= 0 && index < static_cast<int>(this->BuiltLevels.size())
+    ? this->BuiltLevels[index]
+    : nullptr;
+}
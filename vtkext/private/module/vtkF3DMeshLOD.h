@@ -0,0 +1,111 @@
+/**
+ * @class   vtkF3DMeshLOD
+ * @brief   Decimated levels of detail of a large polydata, built in the background
+ *
+ * The levels are built by clustering the points in a sparse grid in a background thread, each
+ * level having about four times fewer cells than the previous one. Input points are kept as representative
+ * points so point and cell data, eg: normals, texture coordinates or skinning attributes,
+ * are preserved.
+ * The levels of a polydata are stored in its information so all the mappers rendering it
+ * share them, and are rebuilt when the polydata is modified. A polydata modified again before
+ * its levels are built, eg: by an animation, is not decimated anymore.
+ */
+
+#ifndef vtkF3DMeshLOD_h
+#define vtkF3DMeshLOD_h
+
+#include <vtkObject.h>
+#include <vtkSmartPointer.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+class vtkInformationObjectBaseKey;
+class vtkPolyData;
+
+class vtkF3DMeshLOD : public vtkObject
+{
+public:
+  static vtkF3DMeshLOD* New();
+  vtkTypeMacro(vtkF3DMeshLOD, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Polydata with fewer polygons than this are always rendered at full resolution.
+   */
+  static constexpr vtkIdType MinimumNumberOfCells = 1000000;
+
+  /**
+   * Get the levels of detail of the provided polydata, starting to build them in the background
+   * if they do not exist or if the polydata was modified since.
+   * Return nullptr if the polydata has less than minimumNumberOfCells polygons or if it was
+   * modified before its levels were built and used, which is the case of animated polydata.
+   */
+  static vtkF3DMeshLOD* GetLevelsOfDetail(
+    vtkPolyData* input, vtkIdType minimumNumberOfCells = MinimumNumberOfCells);
+
+  /**
+   * Key used to store the levels of detail in the polydata information.
+   */
+  static vtkInformationObjectBaseKey* LEVELS_OF_DETAIL();
+
+  /**
+   * Get the coarsest level with at least the provided number of cells.
+   * Return nullptr if the full resolution should be used, including while the levels are built.
+   */
+  vtkPolyData* SelectLevel(double numberOfCells);
+
+  /**
+   * Same as SelectLevel but keep the current level, nullptr being the full resolution, as long
+   * as it would be selected for a number of cells within a factor hysteresis of the provided one,
+   * so that an actor whose size on screen is close to a switching point does not alternate
+   * between two levels, rebuilding its buffers at every frame.
+   */
+  vtkPolyData* SelectLevel(double numberOfCells, vtkPolyData* current, double hysteresis);
+
+  /**
+   * Block until the levels are built.
+   */
+  void Wait();
+
+  /**
+   * Get the number of built levels, excluding the full resolution.
+   */
+  int GetNumberOfLevels();
+
+  /**
+   * Get a built level, 0 being the finest.
+   */
+  vtkPolyData* GetLevel(int index);
+
+protected:
+  vtkF3DMeshLOD() = default;
+  ~vtkF3DMeshLOD() override;
+
+private:
+  vtkF3DMeshLOD(const vtkF3DMeshLOD&) = delete;
+  void operator=(const vtkF3DMeshLOD&) = delete;
+
+  /**
+   * Start building the levels of the provided polydata in the background.
+   */
+  void Build(vtkPolyData* input);
+
+  /**
+   * Collect the levels if the background build is done.
+   */
+  void Poll();
+
+  using Levels = std::vector<vtkSmartPointer<vtkPolyData>>;
+  static Levels BuildLevels(vtkSmartPointer<vtkPolyData> input, const std::atomic<bool>& abort);
+
+  std::future<Levels> Future;
+  std::atomic<bool> Abort{ false };
+  Levels BuiltLevels;
+  vtkIdType InputNumberOfCells = 0;
+  vtkMTimeType InputMTime = 0;
+  bool InputAnimated = false;
+};
+
+#endif
@@ -3,6 +3,7 @@
 #include "F3DLog.h"
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DImporter.h"
+#include "vtkF3DVertexAnimation.h"
 
 #include <vtkActorCollection.h>
 #include <vtkArrowSource.h>
@@ -14,6 +15,8 @@
 #include <vtkImageData.h>
 #include <vtkInformation.h>
 #include <vtkInformationIntegerKey.h>
+#include <vtkLight.h>
+#include <vtkLightCollection.h>
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
@@ -24,9 +27,11 @@
 #include <vtkUnsignedIntArray.h>
 #include <vtkVersion.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 namespace
@@ -175,6 +180,35 @@ protected:
   }
 };
 vtkStandardNewMacro(vtkF3DCollapseOnLoadVisitor);
+
+/**
+ * Remove the structs for which `shouldRemove` returns true, keeping the order of the others.
+ * Structs own non-assignable vtkNew members so kept ones are moved into a new vector.
+ */
+template<typename T, typename F>
+void RemoveStructs(std::vector<T>& structs, F&& shouldRemove)
+{
+  std::vector<T> kept;
+  kept.reserve(structs.size());
+  for (T& s : structs)
+  {
+    if (!shouldRemove(s))
+    {
+      kept.emplace_back(std::move(s));
+    }
+  }
+  structs.swap(kept);
+}
+
+/**
+ * Recover the geometry displayed by an actor, vertex animations being only applied in the
+ * shaders of the actor, so that coloring and point sprites actors follow the animation.
+ */
+vtkSmartPointer<vtkPolyData> GetDisplayedInput(vtkActor* actor)
+{
+  return vtkF3DVertexAnimation::GetAnimatedMesh(
+    actor, vtkPolyDataMapper::SafeDownCast(actor->GetMapper())->GetInput());
+}
 }
 
 //----------------------------------------------------------------------------
@@ -239,8 +273,111 @@ void vtkF3DMetaImporter::AddImporter(
   this->Pimpl->Importers.emplace_back(vtkF3DMetaImporter::ImporterInfo{
     importer.first, importer.second, false, vtkSmartPointer<vtkDataAssembly>::New() });
   this->Modified();
+  this->ObserveImporterProgress(importer.second);
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMetaImporter::ReplaceImporter(
+  vtkImporter* oldImporter, const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer)
+{
+  auto infoIt = std::find_if(this->Pimpl->Importers.begin(), this->Pimpl->Importers.end(),
+    [&](const vtkF3DMetaImporter::ImporterInfo& info) { return info.Importer == oldImporter; });
+  if (infoIt == this->Pimpl->Importers.end())
+  {
+    return false;
+  }
+
+  // Remove all actors and props created for the replaced importer, if it was imported
+  vtkActorCollection* oldActors = oldImporter->GetImportedActors();
+  auto isOldActor = [&](vtkActor* actor) { return oldActors->IsItemPresent(actor) != 0; };
+
+  // The importer added its actors and lights to the renderer itself
+  vtkCollectionSimpleIterator ait;
+  oldActors->InitTraversal(ait);
+  while (vtkActor* actor = oldActors->GetNextActor(ait))
+  {
+    this->ActorCollection->RemoveItem(actor);
+    if (this->Renderer)
+    {
+      this->Renderer->RemoveActor(actor);
+    }
+  }
+
+  if (this->Renderer)
+  {
+    vtkLightCollection* oldLights = oldImporter->GetImportedLights();
+    vtkCollectionSimpleIterator lit;
+    oldLights->InitTraversal(lit);
+    while (vtkLight* light = oldLights->GetNextLight(lit))
+    {
+      this->Renderer->RemoveLight(light);
+    }
+  }
+
+  ::RemoveStructs(this->Pimpl->ColoringActorsAndMappers,
+    [&](vtkF3DMetaImporter::ColoringStruct& cs)
+    {
+      const bool remove = isOldActor(cs.OriginalActor);
+      if (remove && this->Renderer)
+      {
+        this->Renderer->RemoveActor(cs.Actor);
+      }
+      return remove;
+    });
+  ::RemoveStructs(this->Pimpl->NormalGlyphsActorsAndMappers,
+    [&](vtkF3DMetaImporter::NormalGlyphsStruct& ngs)
+    {
+      const bool remove = ngs.Importer == oldImporter;
+      if (remove && this->Renderer)
+      {
+        this->Renderer->RemoveActor(ngs.Actor);
+      }
+      return remove;
+    });
+  ::RemoveStructs(this->Pimpl->PointSpritesActorsAndMappers,
+    [&](vtkF3DMetaImporter::PointSpritesStruct& pss)
+    {
+      const bool remove = pss.Importer == oldImporter;
+      if (remove && this->Renderer)
+      {
+        this->Renderer->RemoveActor(pss.Actor);
+      }
+      return remove;
+    });
+  ::RemoveStructs(this->Pimpl->VolumePropsAndMappers,
+    [&](vtkF3DMetaImporter::VolumeStruct& vs)
+    {
+      const bool remove = isOldActor(vs.OriginalActor);
+      if (remove && this->Renderer)
+      {
+        this->Renderer->RemoveVolume(vs.Prop);
+      }
+      return remove;
+    });
+
+  // Recompute the bounding box from the geometry that is kept
+  this->Pimpl->GeometryBoundingBox.Reset();
+  for (const auto& cs : this->Pimpl->ColoringActorsAndMappers)
+  {
+    double bounds[6];
+    cs.Mapper->GetInput()->GetBounds(bounds);
+    this->Pimpl->GeometryBoundingBox.AddBounds(bounds);
+  }
+
+  // Coloring information is recovered again from all importers on next update
+  this->Pimpl->ColoringInfoHandler.ClearColoringInfo();
+
+  oldImporter->RemoveObservers(vtkCommand::ProgressEvent);
+  *infoIt = vtkF3DMetaImporter::ImporterInfo{ importer.first, importer.second, false,
+    vtkSmartPointer<vtkDataAssembly>::New() };
+  this->Modified();
+  this->ObserveImporterProgress(importer.second);
+  return true;
+}
 
-  // Add a progress event observer
+//----------------------------------------------------------------------------
+void vtkF3DMetaImporter::ObserveImporterProgress(vtkImporter* importer)
+{
   vtkNew<vtkCallbackCommand> progressCallback;
   progressCallback->SetClientData(this);
   progressCallback->SetCallback(
@@ -260,7 +397,7 @@ void vtkF3DMetaImporter::AddImporter(
       }
       self->InvokeEvent(vtkCommand::ProgressEvent, &actualProgress);
     });
-  importer.second->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+  importer->AddObserver(vtkCommand::ProgressEvent, progressCallback);
 }
 
 //----------------------------------------------------------------------------
@@ -882,8 +1019,7 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
   // Update coloring and point sprites
   for (auto& cs : this->Pimpl->ColoringActorsAndMappers)
   {
-    cs.Mapper->SetInputData(
-      vtkPolyDataMapper::SafeDownCast(cs.OriginalActor->GetMapper())->GetInput());
+    cs.Mapper->SetInputData(::GetDisplayedInput(cs.OriginalActor));
 
     bool visi = cs.Actor->GetVisibility();
     cs.Actor->vtkProp3D::ShallowCopy(cs.OriginalActor);
@@ -893,8 +1029,7 @@ bool vtkF3DMetaImporter::UpdateAtTimeValue(double timeValue)
   {
     if (!vtkF3DGenericImporter::SafeDownCast(pss.Importer))
     {
-      pss.Mapper->SetInputData(
-        vtkPolyDataMapper::SafeDownCast(pss.OriginalActor->GetMapper())->GetInput());
+      pss.Mapper->SetInputData(::GetDisplayedInput(pss.OriginalActor));
       bool visi = pss.Actor->GetVisibility();
       pss.Actor->vtkProp3D::ShallowCopy(pss.OriginalActor);
       pss.Actor->SetVisibility(visi);
@@ -116,6 +116,15 @@ public:
    */
   void AddImporter(const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer);
 
+  /**
+   * Replace a previously added importer by another one, in place.
+   * All actors, props and coloring information created for the replaced importer are removed,
+   * the new importer will be imported on the next Update, other importers are left untouched.
+   * Return false if the importer to replace was never added, true otherwise.
+   */
+  bool ReplaceImporter(vtkImporter* oldImporter,
+    const std::pair<std::string, vtkSmartPointer<vtkImporter>>& importer);
+
   /**
    * Get the bounding box of all geometry actors
    * Should be called after actors have been imported
@@ -259,6 +268,11 @@ private:
    */
   void UpdateInfoForColoring();
 
+  /**
+   * Forward progress events of an individual importer as progress of the meta importer
+   */
+  void ObserveImporterProgress(vtkImporter* importer);
+
   struct Internals;
   std::unique_ptr<Internals> Pimpl;
 };
@@ -1,5 +1,7 @@
 #include "vtkF3DOverlayRenderPass.h"
 
+#include "vtkF3DRenderTargetPool.h"
+
 #include <vtkCameraPass.h>
 #include <vtkDefaultPass.h>
 #include <vtkObjectFactory.h>
@@ -60,10 +62,6 @@ void vtkF3DOverlayRenderPass::ReleaseGraphicsResources(vtkWindow* w)
   {
     this->FrameBufferObject->ReleaseGraphicsResources(w);
   }
-  if (this->ColorTexture)
-  {
-    this->ColorTexture->ReleaseGraphicsResources(w);
-  }
 }
 
 // ----------------------------------------------------------------------------
@@ -121,17 +119,9 @@ void vtkF3DOverlayRenderPass::CompositeOverlay(const vtkRenderState* s)
   int size[2];
   r->GetTiledSizeAndOrigin(&size[0], &size[1], &pos[0], &pos[1]);
 
-  if (this->ColorTexture == nullptr)
-  {
-    this->ColorTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->ColorTexture->SetContext(renWin);
-    this->ColorTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->Allocate2D(size[0], size[1], 4, VTK_UNSIGNED_CHAR);
-  }
-  this->ColorTexture->Resize(size[0], size[1]);
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(r);
+  this->ColorTexture =
+    pool->Acquire(renWin, size[0], size[1], vtkF3DRenderTargetPool::Format::RGBA8);
 
   if (this->FrameBufferObject == nullptr)
   {
@@ -219,6 +209,8 @@ void vtkF3DOverlayRenderPass::CompositeOverlay(const vtkRenderState* s)
 
   this->OverlayPass->GetColorTexture()->Deactivate();
   this->ColorTexture->Deactivate();
+  pool->Release(this->ColorTexture);
+  this->ColorTexture = nullptr;
 
   vtkOpenGLCheckErrorMacro("failed after Render");
 }
@@ -1,11 +1,20 @@
 #include "vtkF3DPolyDataMapper.h"
 
 #include "F3DLog.h"
+#include "vtkF3DMeshLOD.h"
+#include "vtkF3DVertexAnimation.h"
 
 #include <vtkActor.h>
+#include <vtkBoundingBox.h>
+#include <vtkCamera.h>
 #include <vtkDoubleArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationIntegerKey.h>
+#include <vtkMath.h>
 #include <vtkMatrix4x4.h>
+#include <vtkNew.h>
 #include <vtkObjectFactory.h>
+#include <vtkOpenGLBufferObject.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkOpenGLRenderer.h>
 #include <vtkOpenGLUniforms.h>
@@ -17,12 +26,17 @@
 #include <vtkShaderProgram.h>
 #include <vtkShaderProperty.h>
 #include <vtkTexture.h>
+#include <vtkTypeTraits.h>
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
+#include <vtk_glad.h>
 
+#include <algorithm>
+#include <cmath>
 #include <regex>
 
 vtkStandardNewMacro(vtkF3DPolyDataMapper);
+vtkInformationKeyMacro(vtkF3DPolyDataMapper, USE_LEVEL_OF_DETAIL, Integer);
 
 //-----------------------------------------------------------------------------
 void vtkF3DPolyDataMapper::ReplaceShaderValues(
@@ -30,68 +44,354 @@ void vtkF3DPolyDataMapper::ReplaceShaderValues(
 {
   this->Superclass::ReplaceShaderValues(shaders, ren, actor);
 
-  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
-  vtkUniforms::TupleType type = uniforms->GetUniformTupleType("jointMatrices");
-  if (type != vtkUniforms::TupleTypeInvalid)
+  // The number of uniform values required by OpenGL is 4096
+  // Since a mat4 is 16 values, it means we can only support 256 bones
+  // However, there are other uniform values used in practice for other
+  // things like materials and we've seen issues starting at 253 bones
+  // so large joint palettes are fetched from a texture buffer by vtkF3DRenderPass instead
+  if (vtkF3DPolyDataMapper::UseJointMatricesBuffer(actor))
   {
-    int nbJoints = uniforms->GetUniformNumberOfTuples("jointMatrices");
+    auto vertexShader = shaders[vtkShader::Vertex];
+    auto VSSource = vertexShader->GetSource();
 
-    // The number of uniform values required by OpenGL is 4096
-    // Since a mat4 is 16 values, it means we can only support 256 bones
-    // However, there are other uniform values used in practice for other
-    // things like materials and we've seen issues starting at 253 bones
-    // let's be conservative here and trigger SSBO at 250 bones
-    if (nbJoints > 250)
-    {
-      vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow());
-      assert(renWin);
+    std::regex regex("uniform mat4 jointMatrices\\[[0-9]+\\];");
+    VSSource = std::regex_replace(VSSource, regex, "");
+
+    vertexShader->SetSource(VSSource);
+  }
 
-      int major, minor;
-      renWin->GetOpenGLVersion(major, minor);
+  // The same applies to the weights of many morph targets,
+  // the non zero weights being fetched from a texture buffer
+  if (vtkF3DPolyDataMapper::UseMorphTargetsBuffer(actor, this->CurrentInput))
+  {
+    auto vertexShader = shaders[vtkShader::Vertex];
+    auto VSSource = vertexShader->GetSource();
 
-      // 4.3 is required for SSBO
-      if (major == 4 && minor >= 3)
-      {
-        // PBR requires linear color space
-        auto vertexShader = shaders[vtkShader::Vertex];
-        auto VSSource = vertexShader->GetSource();
+    std::regex regex("uniform float morphWeights\\[[0-9]+\\];");
+    VSSource = std::regex_replace(VSSource, regex, "");
 
-        std::regex regex("uniform mat4 jointMatrices\\[[0-9]+\\];");
-        VSSource = std::regex_replace(VSSource, regex,
-          "layout(std430, binding = 0) buffer JointMatrices { mat4 jointMatrices[]; };");
+    vertexShader->SetSource(VSSource);
+  }
+}
 
-        vtkShaderProgram::Substitute(VSSource, "//VTK::System::Dec", "#version 430");
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::SetCustomUniforms(vtkOpenGLHelper& cellBO, vtkActor* actor)
+{
+  this->Superclass::SetCustomUniforms(cellBO, actor);
 
-        vertexShader->SetSource(VSSource);
-        this->HasSSBOSkinning = true;
+  vtkShaderProgram* program = cellBO.Program;
+  if (this->HasJointMatricesBuffer)
+  {
+    this->JointMatrices.Bind(program, "jointMatricesBuffer");
+  }
+
+  if (this->HasMorphTargetsBuffer)
+  {
+    this->MorphTargetPositions.Bind(program, "morphTargetPositions");
+    this->MorphTargetNormals.Bind(program, "morphTargetNormals");
+    this->MorphActiveTargets.Bind(program, "morphActiveTargets");
+    // The vertex shader fetches the targets of a point using gl_VertexID, which is only the point
+    // id when the vertex buffer stores the points of the input in order, as built by
+    // vtkOpenGLPolyDataMapper. Other layouts are not morphed rather than wrongly deformed.
+    int nbActiveTargets = this->NumberOfActiveMorphTargets;
+    if (this->VBOs->GetNumberOfTuples("vertexMC") != this->MorphTargetsInput->GetNumberOfPoints())
+    {
+      if (!this->MorphTargetsLayoutWarned)
+      {
+        F3DLog::Print(F3DLog::Severity::Warning,
+          "Morph targets cannot be applied, the vertex buffer does not match the points");
+        this->MorphTargetsLayoutWarned = true;
       }
-      else
+      nbActiveTargets = 0;
+    }
+    if (program->IsUniformUsed("morphActiveCount"))
+    {
+      program->SetUniformi("morphActiveCount", nbActiveTargets);
+    }
+    if (program->IsUniformUsed("morphNumberOfPoints"))
+    {
+      program->SetUniformi("morphNumberOfPoints",
+        static_cast<int>(this->MorphTargetsInput->GetNumberOfPoints()));
+    }
+  }
+
+  if (this->HasKeyframesBuffer)
+  {
+    this->Keyframes.Bind(program, "keyframes");
+    this->KeyframeBounds.Bind(program, "keyframeBounds");
+    // Keyframes are fetched using gl_VertexID as well, the same layout is required
+    vtkIdType nbPoints = this->KeyframesNumberOfPoints;
+    if (nbPoints > 0 && this->VBOs->GetNumberOfTuples("vertexMC") != nbPoints)
+    {
+      if (!this->KeyframesLayoutWarned)
       {
-        std::string msg = "A mesh is associated with more than 250 bones (" +
-          std::to_string(nbJoints) + "), which requires OpenGL >= 4.3";
-        F3DLog::Print(F3DLog::Severity::Warning, msg);
+        F3DLog::Print(F3DLog::Severity::Warning,
+          "Vertex animation cannot be applied, the vertex buffer does not match the points");
+        this->KeyframesLayoutWarned = true;
+      }
+      nbPoints = 0;
+    }
+    if (program->IsUniformUsed("keyframeNumberOfPoints"))
+    {
+      program->SetUniformi("keyframeNumberOfPoints", static_cast<int>(nbPoints));
+    }
+  }
+}
 
-        uniforms->RemoveUniform("jointMatrices");
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::ReleaseGraphicsResources(vtkWindow* window)
+{
+  for (TextureBuffer* buffer : { &this->JointMatrices, &this->MorphTargetPositions,
+         &this->MorphTargetNormals, &this->MorphActiveTargets, &this->Keyframes,
+         &this->KeyframeBounds })
+  {
+    buffer->Texture->ReleaseGraphicsResources(window);
+    buffer->Buffer->ReleaseGraphicsResources();
+  }
+  this->MorphTargetsInput = nullptr;
+  this->KeyframesAnimation = nullptr;
+
+  for (vtkF3DPolyDataMapper* levelMapper : this->LevelMappers)
+  {
+    levelMapper->ReleaseGraphicsResources(window);
+  }
+
+  this->Superclass::ReleaseGraphicsResources(window);
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::UseJointMatricesBuffer([[maybe_unused]] vtkActor* actor)
+{
+#ifdef F3D_USE_GLES
+  return false;
+#else
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  return uniforms->GetUniformTupleType("jointMatrices") != vtkUniforms::TupleTypeInvalid &&
+    uniforms->GetUniformNumberOfTuples("jointMatrices") >
+    vtkF3DPolyDataMapper::MaximumUniformJoints;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+int vtkF3DPolyDataMapper::GetNumberOfMorphTargets(vtkActor* actor, vtkPolyData* input)
+{
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  if (!input || uniforms->GetUniformTupleType("morphWeights") == vtkUniforms::TupleTypeInvalid)
+  {
+    return 0;
+  }
+
+  const int nbWeights = uniforms->GetUniformNumberOfTuples("morphWeights");
+  int nbTargets = 0;
+  while (nbTargets < nbWeights &&
+    input->GetPointData()->GetArray(("target" + std::to_string(nbTargets) + "_position").c_str()))
+  {
+    nbTargets++;
+  }
+  return nbTargets;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::UseMorphTargetsBuffer(
+  [[maybe_unused]] vtkActor* actor, [[maybe_unused]] vtkPolyData* input)
+{
+#ifdef F3D_USE_GLES
+  return false;
+#else
+  return vtkF3DPolyDataMapper::GetNumberOfMorphTargets(actor, input) >
+    vtkF3DPolyDataMapper::MaximumAttributeMorphTargets;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::UseKeyframesBuffer(
+  [[maybe_unused]] vtkActor* actor, [[maybe_unused]] vtkPolyData* input)
+{
+#ifdef F3D_USE_GLES
+  return false;
+#else
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  return uniforms->GetUniformTupleType("keyframeFactor") != vtkUniforms::TupleTypeInvalid &&
+    vtkF3DVertexAnimation::GetVertexAnimation(input) != nullptr;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void vtkF3DPolyDataMapper::TextureBuffer::Upload(
+  vtkOpenGLRenderWindow* renWin, const std::vector<T>& values, int numComps)
+{
+  // Integer values are normalized to [0, 1] when sampled
+  this->Texture->SetContext(renWin);
+  this->Buffer->Upload(values, vtkOpenGLBufferObject::TextureBuffer);
+  this->Texture->CreateTextureBuffer(static_cast<unsigned int>(values.size() / numComps),
+    numComps, vtkTypeTraits<T>::VTK_TYPE_ID, this->Buffer);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::TextureBuffer::Bind(vtkShaderProgram* program, const char* name)
+{
+  if (program->IsUniformUsed(name))
+  {
+    this->Texture->Activate();
+    program->SetUniformi(name, this->Texture->GetTextureUnit());
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::UpdateJointMatrices(vtkOpenGLRenderWindow* renWin, vtkActor* actor)
+{
+  this->HasJointMatricesBuffer = vtkF3DPolyDataMapper::UseJointMatricesBuffer(actor);
+  if (!this->HasJointMatricesBuffer)
+  {
+    return;
+  }
+
+  // Each column of a matrix is a texel
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  std::vector<float> buffer(16 * uniforms->GetUniformNumberOfTuples("jointMatrices"));
+  uniforms->GetUniformMatrix4x4v("jointMatrices", buffer);
+  this->JointMatrices.Upload(renWin, buffer, 4);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::UpdateMorphTargets(vtkOpenGLRenderWindow* renWin, vtkActor* actor)
+{
+  vtkPolyData* input = this->CurrentInput;
+  this->HasMorphTargetsBuffer = vtkF3DPolyDataMapper::UseMorphTargetsBuffer(actor, input);
+  if (!this->HasMorphTargetsBuffer)
+  {
+    return;
+  }
+
+  // The targets are only uploaded when the input changes, the target t of the point p being
+  // stored in the texel t * nbPoints + p
+  const vtkIdType nbPoints = input->GetNumberOfPoints();
+  if (input != this->MorphTargetsInput || input->GetMTime() > this->MorphTargetsTime)
+  {
+    GLint maxTexels = VTK_INT_MAX;
+#ifndef F3D_USE_GLES
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+#endif
+
+    int nbTargets = vtkF3DPolyDataMapper::GetNumberOfMorphTargets(actor, input);
+    if (nbPoints > 0 && nbTargets * nbPoints > maxTexels)
+    {
+      nbTargets = static_cast<int>(maxTexels / nbPoints);
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Morph targets exceed the texture buffer size of this GPU, only the first " +
+          std::to_string(nbTargets) + " are used");
+    }
+
+    bool hasNormals = false;
+    std::vector<float> positions(4 * nbTargets * nbPoints, 0.f);
+    std::vector<float> normals(positions.size(), 0.f);
+    for (int target = 0; target < nbTargets; target++)
+    {
+      const std::string name = "target" + std::to_string(target);
+      vtkDataArray* positionArray = input->GetPointData()->GetArray((name + "_position").c_str());
+      vtkDataArray* normalArray = input->GetPointData()->GetArray((name + "_normal").c_str());
+      hasNormals = hasNormals || normalArray;
+      for (vtkIdType i = 0; i < nbPoints; i++)
+      {
+        const vtkIdType texel = 4 * (target * nbPoints + i);
+        for (int comp = 0; comp < 3; comp++)
+        {
+          positions[texel + comp] = static_cast<float>(positionArray->GetComponent(i, comp));
+          if (normalArray)
+          {
+            normals[texel + comp] = static_cast<float>(normalArray->GetComponent(i, comp));
+          }
+        }
       }
     }
+
+    // Texture buffers cannot be empty
+    positions.resize(std::max<size_t>(positions.size(), 4), 0.f);
+    this->MorphTargetPositions.Upload(renWin, positions, 4);
+    this->MorphTargetNormals.Upload(renWin, hasNormals ? normals : std::vector<float>(4, 0.f), 4);
+
+    this->MorphTargetsInput = input;
+    this->MorphTargetsTime = input->GetMTime();
+    this->NumberOfStoredMorphTargets = nbTargets;
+    this->MorphTargetsLayoutWarned = false;
   }
+
+  // Only the targets with a non zero weight are applied, largest weights first
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  std::vector<float> weights;
+  uniforms->GetUniform1fv("morphWeights", weights);
+
+  std::vector<int> activeTargets;
+  for (int target = 0; target < this->NumberOfStoredMorphTargets; target++)
+  {
+    if (target < static_cast<int>(weights.size()) && weights[target] != 0.f)
+    {
+      activeTargets.push_back(target);
+    }
+  }
+  std::ranges::sort(activeTargets,
+    [&](int a, int b) { return std::abs(weights[a]) > std::abs(weights[b]); });
+
+  std::vector<float> active(2 * std::max<size_t>(activeTargets.size(), 1), 0.f);
+  for (size_t i = 0; i < activeTargets.size(); i++)
+  {
+    active[2 * i] = static_cast<float>(activeTargets[i]);
+    active[2 * i + 1] = weights[activeTargets[i]];
+  }
+  this->MorphActiveTargets.Upload(renWin, active, 2);
+  this->NumberOfActiveMorphTargets = static_cast<int>(activeTargets.size());
 }
 
 //-----------------------------------------------------------------------------
-void vtkF3DPolyDataMapper::SetCustomUniforms(vtkOpenGLHelper& cellBO, vtkActor* actor)
+void vtkF3DPolyDataMapper::UpdateKeyframes(vtkOpenGLRenderWindow* renWin, vtkActor* actor)
 {
-  this->Superclass::SetCustomUniforms(cellBO, actor);
+  vtkPolyData* input = this->CurrentInput;
+  this->HasKeyframesBuffer = vtkF3DPolyDataMapper::UseKeyframesBuffer(actor, input);
+  if (!this->HasKeyframesBuffer)
+  {
+    return;
+  }
 
-  if (this->HasSSBOSkinning)
+  // The encoded keyframes are only uploaded when they change, the point p of the keyframe k
+  // being stored in the texel k * nbPoints + p
+  vtkF3DVertexAnimation* animation = vtkF3DVertexAnimation::GetVertexAnimation(input);
+  if (animation == this->KeyframesAnimation && animation->GetMTime() <= this->KeyframesTime)
   {
-    vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+    return;
+  }
+
+  GLint maxTexels = VTK_INT_MAX;
+#ifndef F3D_USE_GLES
+  glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+#endif
 
-    std::vector<float> buffer(16 * uniforms->GetUniformNumberOfTuples("jointMatrices"));
-    uniforms->GetUniformMatrix4x4v("jointMatrices", buffer);
+  const vtkIdType nbPoints = animation->GetNumberOfPoints();
+  const std::vector<unsigned short>& keyframes = animation->GetEncodedKeyframes();
+  if (nbPoints > 0 && static_cast<vtkIdType>(keyframes.size() / 4) <= maxTexels)
+  {
+    this->Keyframes.Upload(renWin, keyframes, 4);
+    this->KeyframeBounds.Upload(renWin, animation->GetKeyframeBounds(), 4);
+    this->KeyframesNumberOfPoints = nbPoints;
+  }
+  else
+  {
+    if (nbPoints > 0)
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Vertex animation keyframes exceed the texture buffer size of this GPU, "
+        "the animation is not displayed");
+    }
 
-    this->JointMatrices->Upload(buffer, vtkOpenGLBufferObject::ArrayBuffer);
-    this->JointMatrices->BindShaderStorage(0);
+    // Texture buffers cannot be empty
+    this->Keyframes.Upload(renWin, std::vector<unsigned short>(4, 0), 4);
+    this->KeyframeBounds.Upload(renWin, std::vector<float>(4, 0.f), 4);
+    this->KeyframesNumberOfPoints = 0;
   }
+
+  this->KeyframesAnimation = animation;
+  this->KeyframesTime = animation->GetMTime();
+  this->KeyframesLayoutWarned = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -145,3 +445,133 @@ void vtkF3DPolyDataMapper::ReplaceShaderLight(
 
   this->Superclass::ReplaceShaderLight(shaders, ren, actor);
 }
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::RenderPiece(vtkRenderer* ren, vtkActor* actor)
+{
+  this->LevelOfDetail = this->SelectLevelOfDetail(ren, actor);
+  if (this->LevelOfDetail)
+  {
+    this->GetLevelMapper(this->LevelOfDetail)->RenderPiece(ren, actor);
+    return;
+  }
+
+  this->Superclass::RenderPiece(ren, actor);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::RenderPieceStart(vtkRenderer* ren, vtkActor* actor)
+{
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow());
+  this->UpdateJointMatrices(renWin, actor);
+  this->UpdateMorphTargets(renWin, actor);
+  this->UpdateKeyframes(renWin, actor);
+
+  this->Superclass::RenderPieceStart(ren, actor);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::RenderPieceFinish(vtkRenderer* ren, vtkActor* actor)
+{
+  for (TextureBuffer* buffer : { &this->JointMatrices, &this->MorphTargetPositions,
+         &this->MorphTargetNormals, &this->MorphActiveTargets, &this->Keyframes,
+         &this->KeyframeBounds })
+  {
+    buffer->Texture->Deactivate();
+  }
+
+  this->Superclass::RenderPieceFinish(ren, actor);
+}
+
+//-----------------------------------------------------------------------------
+vtkPolyData* vtkF3DPolyDataMapper::SelectLevelOfDetail(vtkRenderer* ren, vtkActor* actor)
+{
+  vtkInformation* info = ren->GetInformation();
+  if (!this->LevelOfDetailEnabled || !info->Has(vtkF3DPolyDataMapper::USE_LEVEL_OF_DETAIL()) ||
+    !info->Get(vtkF3DPolyDataMapper::USE_LEVEL_OF_DETAIL()))
+  {
+    return nullptr;
+  }
+
+  // Levels of detail do not have the keyframes of a vertex animation
+  vtkPolyData* input = this->GetInput();
+  vtkF3DMeshLOD* lod = vtkF3DMeshLOD::GetLevelsOfDetail(input);
+  if (lod != this->LevelMappersLOD)
+  {
+    // The levels were rebuilt, the mappers of the previous levels are not needed anymore
+    this->LevelMappers.clear();
+    this->LevelMappersLOD = lod;
+  }
+  if (!lod || vtkF3DVertexAnimation::GetVertexAnimation(input))
+  {
+    return nullptr;
+  }
+
+  // Approximate the actor by its bounding sphere and compute its area on screen in pixels
+  vtkBoundingBox box(actor->GetBounds());
+  if (!box.IsValid())
+  {
+    return nullptr;
+  }
+  double center[3];
+  box.GetCenter(center);
+  const double radius = box.GetDiagonalLength() / 2.0;
+
+  vtkCamera* camera = ren->GetActiveCamera();
+  const double height = ren->GetSize()[1];
+  double pixelsPerUnit;
+  if (camera->GetParallelProjection())
+  {
+    pixelsPerUnit = height / (2.0 * camera->GetParallelScale());
+  }
+  else
+  {
+    const double distance =
+      std::sqrt(vtkMath::Distance2BetweenPoints(center, camera->GetPosition()));
+    if (distance <= radius)
+    {
+      // The camera is close to or inside the actor
+      return nullptr;
+    }
+    pixelsPerUnit = height /
+      (2.0 * distance * std::tan(vtkMath::RadiansFromDegrees(camera->GetViewAngle()) / 2.0));
+  }
+
+  const double pixelRadius = radius * pixelsPerUnit;
+  return lod->SelectLevel(vtkMath::Pi() * pixelRadius * pixelRadius, this->LevelOfDetail,
+    vtkF3DPolyDataMapper::LevelOfDetailHysteresis);
+}
+
+//-----------------------------------------------------------------------------
+vtkF3DPolyDataMapper* vtkF3DPolyDataMapper::GetLevelMapper(vtkPolyData* level)
+{
+  // Copy the coloring and rendering parameters again if they changed
+  const bool modified = this->vtkObject::GetMTime() > this->LevelMappersTime;
+  this->LevelMappersTime = this->vtkObject::GetMTime();
+
+  vtkF3DPolyDataMapper* levelMapper = nullptr;
+  for (vtkF3DPolyDataMapper* mapper : this->LevelMappers)
+  {
+    if (modified)
+    {
+      mapper->ShallowCopy(this);
+      mapper->SetInputData(mapper->Level);
+    }
+    if (mapper->Level == level)
+    {
+      levelMapper = mapper;
+    }
+  }
+
+  if (!levelMapper)
+  {
+    vtkNew<vtkF3DPolyDataMapper> mapper;
+    mapper->LevelOfDetailEnabled = false;
+    mapper->Level = level;
+    mapper->ShallowCopy(this);
+    mapper->SetInputData(level);
+    this->LevelMappers.emplace_back(mapper);
+    levelMapper = mapper;
+  }
+  return levelMapper;
+}
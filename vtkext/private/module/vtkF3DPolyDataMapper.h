@@ -2,15 +2,25 @@
  * @class   vtkF3DPolyDataMapper
  * @brief   Custom surface mapper used to include F3D features
  *
- * This mapper is used to add support for SSBO skinning and
- * backward compatibility with old VTK versions for unlit materials.
+ * This mapper is used to add support for large joint palettes, any number of morph targets and
+ * vtkF3DVertexAnimation keyframes stored in texture buffers, backward compatibility with old VTK
+ * versions for unlit materials and levels of detail selected from the projected size of the actor.
  */
 
 #ifndef vtkF3DPolyDataMapper_h
 #define vtkF3DPolyDataMapper_h
 
 #include <vtkOpenGLPolyDataMapper.h>
+#include <vtkSmartPointer.h>
+#include <vtkTextureObject.h>
 #include <vtkVersion.h>
+#include <vtkWeakPointer.h>
+
+#include <vector>
+
+class vtkF3DMeshLOD;
+class vtkInformationIntegerKey;
+class vtkOpenGLRenderWindow;
 
 class vtkF3DPolyDataMapper : public vtkOpenGLPolyDataMapper
 {
@@ -35,17 +45,161 @@ public:
   ///@}
 
   /**
-   * Set the SSBO for skinning if needed
+   * Bind the texture buffers used for skinning and morphing if needed
    */
   void SetCustomUniforms(vtkOpenGLHelper& cellBO, vtkActor* actor) override;
 
+  /**
+   * Release the texture buffers
+   */
+  void ReleaseGraphicsResources(vtkWindow* window) override;
+
+  /**
+   * Number of joints above which the joint matrices are stored in a texture buffer instead of a
+   * uniform array, as the number of uniform values is limited.
+   */
+  static constexpr int MaximumUniformJoints = 250;
+
+  /**
+   * Number of morph targets above which the targets are stored in texture buffers instead of
+   * vertex attributes, as the number of vertex attributes is limited.
+   */
+  static constexpr int MaximumAttributeMorphTargets = 4;
+
+  /**
+   * Check if the joint matrices of the actor are stored in a texture buffer.
+   * Always false with GLES, which does not support texture buffers.
+   */
+  static bool UseJointMatricesBuffer(vtkActor* actor);
+
+  /**
+   * Get the number of morph targets of the input, from the consecutive target{i}_position arrays
+   * with a weight in the morphWeights uniform of the actor.
+   */
+  static int GetNumberOfMorphTargets(vtkActor* actor, vtkPolyData* input);
+
+  /**
+   * Check if the morph targets of the input are stored in texture buffers.
+   * Always false with GLES, which does not support texture buffers.
+   */
+  static bool UseMorphTargetsBuffer(vtkActor* actor, vtkPolyData* input);
+
+  /**
+   * Check if the vtkF3DVertexAnimation keyframes of the input are stored in texture buffers,
+   * which is the case when the actor displays an interpolation of the keyframes.
+   * Always false with GLES, which does not support texture buffers.
+   */
+  static bool UseKeyframesBuffer(vtkActor* actor, vtkPolyData* input);
+
+  /**
+   * Key to set in the renderer information to render large inputs with the vtkF3DMeshLOD
+   * level matching the size of the actor on screen, using about one cell per pixel.
+   */
+  static vtkInformationIntegerKey* USE_LEVEL_OF_DETAIL();
+
+  /**
+   * Factor by which the size of the actor on screen must change before another level of detail
+   * is selected, to avoid alternating between two levels at every frame near a switching point.
+   */
+  static constexpr double LevelOfDetailHysteresis = 1.5;
+
+  /**
+   * Get the level of detail used by the last render, nullptr if the input was rendered.
+   */
+  vtkPolyData* GetLevelOfDetail()
+  {
+    return this->LevelOfDetail;
+  }
+
 protected:
   vtkF3DPolyDataMapper() = default;
   ~vtkF3DPolyDataMapper() override = default;
 
+  /**
+   * Render the selected level of detail instead of the input if any.
+   * Each level is rendered by its own mapper so that the buffer objects of all the used levels
+   * are kept and switching between levels does not upload anything.
+   */
+  void RenderPiece(vtkRenderer* ren, vtkActor* actor) override;
+
+  /**
+   * Upload the texture buffers used for skinning and morphing
+   */
+  void RenderPieceStart(vtkRenderer* ren, vtkActor* actor) override;
+
+  /**
+   * Deactivate the texture buffers
+   */
+  void RenderPieceFinish(vtkRenderer* ren, vtkActor* actor) override;
+
 private:
-  vtkNew<vtkOpenGLBufferObject> JointMatrices;
-  bool HasSSBOSkinning = false;
+  /**
+   * Select the level of detail to render, nullptr for the input
+   */
+  vtkPolyData* SelectLevelOfDetail(vtkRenderer* ren, vtkActor* actor);
+
+  /**
+   * Get the mapper rendering the provided level, creating it if needed,
+   * with the same parameters as this mapper
+   */
+  vtkF3DPolyDataMapper* GetLevelMapper(vtkPolyData* level);
+
+  /**
+   * A buffer object sampled in shaders through a texture
+   */
+  struct TextureBuffer
+  {
+    vtkNew<vtkOpenGLBufferObject> Buffer;
+    vtkNew<vtkTextureObject> Texture;
+
+    template<typename T>
+    void Upload(vtkOpenGLRenderWindow* renWin, const std::vector<T>& values, int numComps);
+    void Bind(vtkShaderProgram* program, const char* name);
+  };
+
+  /**
+   * Upload the joint matrices in a texture buffer if needed
+   */
+  void UpdateJointMatrices(vtkOpenGLRenderWindow* renWin, vtkActor* actor);
+
+  /**
+   * Upload the morph targets of the current input if they changed, and the targets with a
+   * non zero weight, in texture buffers if needed
+   */
+  void UpdateMorphTargets(vtkOpenGLRenderWindow* renWin, vtkActor* actor);
+
+  /**
+   * Upload the encoded keyframes of the vertex animation of the current input if they changed
+   */
+  void UpdateKeyframes(vtkOpenGLRenderWindow* renWin, vtkActor* actor);
+
+  vtkSmartPointer<vtkPolyData> LevelOfDetail;
+  std::vector<vtkSmartPointer<vtkF3DPolyDataMapper>> LevelMappers;
+  vtkWeakPointer<vtkF3DMeshLOD> LevelMappersLOD;
+  vtkMTimeType LevelMappersTime = 0;
+  vtkPolyData* Level = nullptr;
+  bool LevelOfDetailEnabled = true;
+
+  TextureBuffer JointMatrices;
+  bool HasJointMatricesBuffer = false;
+
+  TextureBuffer MorphTargetPositions;
+  TextureBuffer MorphTargetNormals;
+  TextureBuffer MorphActiveTargets;
+  bool HasMorphTargetsBuffer = false;
+  vtkPolyData* MorphTargetsInput = nullptr;
+  vtkMTimeType MorphTargetsTime = 0;
+  int NumberOfStoredMorphTargets = 0;
+  int NumberOfActiveMorphTargets = 0;
+  bool MorphTargetsLayoutWarned = false;
+
+  TextureBuffer Keyframes;
+  TextureBuffer KeyframeBounds;
+  bool HasKeyframesBuffer = false;
+  vtkObject* KeyframesAnimation = nullptr;
+  vtkMTimeType KeyframesTime = 0;
+  vtkIdType KeyframesNumberOfPoints = 0;
+  bool KeyframesLayoutWarned = false;
 };
 
 #endif
@@ -4,9 +4,11 @@
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DImporter.h"
 #include "vtkF3DOpenGLGridMapper.h"
+#include "vtkF3DPolyDataMapper.h"
 #include "vtkF3DRenderer.h"
 #include "vtkF3DStochasticTransparentPass.h"
 #include "vtkF3DTAAPass.h"
+#include "vtkF3DVertexAnimation.h"
 
 #include <vtkBoundingBox.h>
 #include <vtkCamera.h>
@@ -48,6 +50,7 @@
 #include <vtkOSPRayPass.h>
 #endif
 
+#include <array>
 #include <sstream>
 
 vtkStandardNewMacro(vtkF3DRenderPass);
@@ -97,6 +100,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
   this->MainOnTopProps.clear();
   this->MainProps.clear();
   this->ReflectionProps.clear();
+  this->NonCullableProps.clear();
 
   // assign props to the correct pass
   vtkProp** props = s->GetPropArray();
@@ -142,6 +146,15 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
                 continue;
               }
 
+              // deformed actors cannot be culled from their input bounds
+              auto setNonCullable = [&]()
+              {
+                if (this->NonCullableProps.empty() || this->NonCullableProps.back() != prop)
+                {
+                  this->NonCullableProps.push_back(prop);
+                }
+              };
+
               // skinning
               if (input->GetPointData()->GetArray("WEIGHTS_0") != nullptr &&
                 input->GetPointData()->GetArray("JOINTS_0") != nullptr)
@@ -151,13 +164,27 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
                   "weights", "WEIGHTS_0", vtkDataObject::FIELD_ASSOCIATION_POINTS);
                 polyMapper->MapDataArrayToVertexAttribute(
                   "joints", "JOINTS_0", vtkDataObject::FIELD_ASSOCIATION_POINTS);
+                setNonCullable();
+              }
+
+              // vertex animation, keyframes are applied in the vertex shader
+              if (vtkF3DVertexAnimation::GetVertexAnimation(input))
+              {
+                setNonCullable();
               }
 
               // morph targets
               // OpenGL limits the input attributes to 16 vectors
               // We ignore morphing on tangent on purpose to maximize the number of targets we
               // can support
-              for (int j = 0; j < 4; j++)
+              // Many targets are fetched from texture buffers instead, see vtkF3DPolyDataMapper
+              const bool useMorphTargetsBuffer =
+                vtkF3DPolyDataMapper::UseMorphTargetsBuffer(actor, input);
+              if (useMorphTargetsBuffer)
+              {
+                setNonCullable();
+              }
+              for (int j = 0; j < 4 && !useMorphTargetsBuffer; j++)
               {
                 std::string namePosition = "target" + std::to_string(j) + "_position";
 
@@ -168,6 +195,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
 
                 polyMapper->MapDataArrayToVertexAttribute(namePosition.c_str(),
                   namePosition.c_str(), vtkDataObject::FIELD_ASSOCIATION_POINTS);
+                setNonCullable();
 
                 std::string nameNormal = "target" + std::to_string(j) + "_normal";
                 if (input->GetPointData()->GetArray(nameNormal.c_str()) != nullptr)
@@ -191,14 +219,40 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     }
   }
 
+  vtkOpenGLRenderer* glRenderer = vtkOpenGLRenderer::SafeDownCast(s->GetRenderer());
+  this->LightComplexity = glRenderer->GetLightingComplexity();
+
   if (this->InitializeTime == this->MTime)
   {
     // already initialized
+    this->ConfigureGridReflection();
     return;
   }
 
-  vtkOpenGLRenderer* glRenderer = vtkOpenGLRenderer::SafeDownCast(s->GetRenderer());
-  this->LightComplexity = glRenderer->GetLightingComplexity();
+  // Only rebuild the passes when the structure of the graph changes, other parameters are
+  // updated in place to keep the framebuffers, the TAA history and the shader programs
+  const vtkBoundingBox bbox(this->Bounds);
+  const vtkF3DRenderer* f3dRenderer = vtkF3DRenderer::SafeDownCast(glRenderer);
+  const std::array<int, 5> structure = { this->UseRaytracing,
+    this->UseSSAOPass && bbox.IsValid(), this->UseBlurBackground,
+    this->UseTemporalAntiAliasing,
+    f3dRenderer ? static_cast<int>(f3dRenderer->GetBlendingMode()) : -1 };
+  if (this->MainPass && structure == this->PassesStructure)
+  {
+    if (this->BlurPass)
+    {
+      this->BlurPass->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
+    }
+    if (this->SSAOPass)
+    {
+      this->SSAOPass->SetRadius(0.1 * bbox.GetDiagonalLength());
+      this->SSAOPass->SetBias(0.001 * bbox.GetDiagonalLength());
+    }
+    this->ConfigureGridReflection();
+    this->InitializeTime = this->GetMTime();
+    return;
+  }
+  this->PassesStructure = structure;
 
   this->ReleaseGraphicsResources(glRenderer->GetRenderWindow());
 
@@ -211,16 +265,19 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
 
   if (this->UseBlurBackground)
   {
-    vtkNew<vtkF3DHexagonalBokehBlurPass> blur;
-    blur->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
-    blur->SetDelegatePass(bgCamP);
-    this->BackgroundPass->SetDelegatePass(blur);
+    this->BlurPass = vtkSmartPointer<vtkF3DHexagonalBokehBlurPass>::New();
+    this->BlurPass->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
+    this->BlurPass->SetDelegatePass(bgCamP);
+    this->BackgroundPass->SetDelegatePass(this->BlurPass);
   }
   else
   {
+    this->BlurPass = nullptr;
     this->BackgroundPass->SetDelegatePass(bgCamP);
   }
 
+  this->SSAOPass = nullptr;
+
   // main pass
 #if F3D_MODULE_RAYTRACING
   if (this->UseRaytracing)
@@ -229,6 +286,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     this->MainPass = vtkSmartPointer<vtkFramebufferPass>::New();
     this->MainPass->SetDelegatePass(ospP);
     this->MainPass->SetColorFormat(vtkTextureObject::Float32);
+    this->BakeReflectionPass = nullptr;
   }
   else
 #endif
@@ -244,19 +302,18 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     // opaque passes
     if (this->UseSSAOPass)
     {
-      vtkBoundingBox bbox(this->Bounds);
       if (bbox.IsValid())
       {
         vtkNew<vtkCameraPass> ssaoCamP;
         ssaoCamP->SetDelegatePass(opaqueP);
 
-        vtkNew<vtkSSAOPass> ssaoP;
-        ssaoP->SetRadius(0.1 * bbox.GetDiagonalLength());
-        ssaoP->SetBias(0.001 * bbox.GetDiagonalLength());
-        ssaoP->SetKernelSize(200);
-        ssaoP->SetDelegatePass(ssaoCamP);
+        this->SSAOPass = vtkSmartPointer<vtkSSAOPass>::New();
+        this->SSAOPass->SetRadius(0.1 * bbox.GetDiagonalLength());
+        this->SSAOPass->SetBias(0.001 * bbox.GetDiagonalLength());
+        this->SSAOPass->SetKernelSize(200);
+        this->SSAOPass->SetDelegatePass(ssaoCamP);
 
-        collection->AddItem(ssaoP);
+        collection->AddItem(this->SSAOPass);
       }
       else
       {
@@ -269,7 +326,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     }
 
     // translucent and volumic
-    const vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(glRenderer);
+    const vtkF3DRenderer* renderer = f3dRenderer;
     if (renderer && renderer->GetBlendingMode() == vtkF3DRenderer::BlendingMode::DUAL_DEPTH_PEELING)
     {
 #ifdef F3D_USE_GLES
@@ -315,7 +372,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
 #endif
 
     // TAA
-    if (renderer && renderer->GetAntiAliasingMode() == vtkF3DRenderer::AntiAliasingMode::TAA)
+    if (this->UseTemporalAntiAliasing)
     {
       vtkNew<vtkF3DTAAPass> taaP;
       taaP->SetDelegatePass(camP);
@@ -326,31 +383,18 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
         vtkCommand::InteractionEvent, taaP.Get(), &vtkF3DTAAPass::ResetIterations);
 
       this->MainPass->SetDelegatePass(taaP);
+      this->TAAPass = taaP;
     }
     else
     {
       this->MainPass->SetDelegatePass(camP);
+      this->TAAPass = nullptr;
     }
 
     // reflection baking pass, same as main pass but with reflected camera
     this->BakeReflectionPass = vtkSmartPointer<vtkFramebufferPass>::New();
     this->BakeReflectionPass->SetColorFormat(vtkTextureObject::Float16);
     this->BakeReflectionPass->SetDelegatePass(camP);
-
-    for (int i = 0; i < s->GetPropArrayCount(); i++)
-    {
-      vtkActor* actor = vtkActor::SafeDownCast(props[i]);
-      if (actor)
-      {
-        vtkF3DOpenGLGridMapper* gridMapper =
-          vtkF3DOpenGLGridMapper::SafeDownCast(actor->GetMapper());
-        if (gridMapper)
-        {
-          gridMapper->SetReflectionColorTexture(this->BakeReflectionPass->GetColorTexture());
-          gridMapper->SetReflectionDepthTexture(this->BakeReflectionPass->GetDepthTexture());
-        }
-      }
-    }
   }
 
   {
@@ -379,9 +423,32 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
 #endif
   }
 
+  this->ConfigureGridReflection();
   this->InitializeTime = this->GetMTime();
 }
 
+// ----------------------------------------------------------------------------
+void vtkF3DRenderPass::ConfigureGridReflection()
+{
+  if (!this->BakeReflectionPass)
+  {
+    return;
+  }
+
+  // The grid can be recreated while the passes are kept, always provide the reflection textures
+  for (vtkProp* prop : this->MainProps)
+  {
+    vtkActor* actor = vtkActor::SafeDownCast(prop);
+    vtkF3DOpenGLGridMapper* gridMapper =
+      actor ? vtkF3DOpenGLGridMapper::SafeDownCast(actor->GetMapper()) : nullptr;
+    if (gridMapper)
+    {
+      gridMapper->SetReflectionColorTexture(this->BakeReflectionPass->GetColorTexture());
+      gridMapper->SetReflectionDepthTexture(this->BakeReflectionPass->GetDepthTexture());
+    }
+  }
+}
+
 // ----------------------------------------------------------------------------
 void vtkF3DRenderPass::ReplaceMatCapShader(
   std::string& fragmentShader, vtkActor* actor, vtkPolyData* polyData)
@@ -428,8 +495,9 @@ void vtkF3DRenderPass::ReplaceSkinningMorphing(
       uniforms->GetUniformTupleType("morphWeights") != vtkUniforms::TupleTypeInvalid;
     bool hasSkinning =
       uniforms->GetUniformTupleType("jointMatrices") != vtkUniforms::TupleTypeInvalid;
+    bool hasKeyframes = vtkF3DPolyDataMapper::UseKeyframesBuffer(actor, polyData);
 
-    if (hasMorphing || hasSkinning)
+    if (hasMorphing || hasSkinning || hasKeyframes)
     {
       bool hasTangents =
         polyData->GetPointData()->GetTangents() && actor->GetProperty()->GetLighting();
@@ -457,10 +525,90 @@ void vtkF3DRenderPass::ReplaceSkinningMorphing(
 #endif
       }
 
-      // morphing
-      if (hasMorphing)
+      // vertex animation, the two displayed keyframes are decoded from texture buffers storing
+      // quantized positions and octahedral encoded normals, see vtkF3DVertexAnimation
+      if (hasKeyframes)
       {
-        for (int i = 0; i < 4; i++)
+        // clang-format off
+        customDecl +=
+          "uniform samplerBuffer keyframes;\n"
+          "uniform samplerBuffer keyframeBounds;\n"
+          "uniform int keyframeNumberOfPoints;\n"
+          "vec4 fetchKeyframe(int keyframe)\n"
+          "{\n"
+          "  return texelFetch(keyframes, keyframe * keyframeNumberOfPoints + gl_VertexID);\n"
+          "}\n"
+          "vec3 decodeKeyframePosition(int keyframe)\n"
+          "{\n"
+          "  return texelFetch(keyframeBounds, 2 * keyframe).xyz +\n"
+          "    fetchKeyframe(keyframe).xyz * texelFetch(keyframeBounds, 2 * keyframe + 1).xyz;\n"
+          "}\n"
+          "vec3 decodeKeyframeNormal(int keyframe)\n"
+          "{\n"
+          "  int packed = int(fetchKeyframe(keyframe).w * 65535.0 + 0.5);\n"
+          "  vec2 oct = vec2(packed >> 8, packed & 255) / 127.5 - 1.0;\n"
+          "  vec3 normal = vec3(oct, 1.0 - abs(oct.x) - abs(oct.y));\n"
+          "  if (normal.z < 0.0)\n"
+          "  {\n"
+          "    vec2 signs = vec2(oct.x >= 0.0 ? 1.0 : -1.0, oct.y >= 0.0 ? 1.0 : -1.0);\n"
+          "    normal.xy = (1.0 - abs(oct.yx)) * signs;\n"
+          "  }\n"
+          "  return normalize(normal);\n"
+          "}\n";
+        // clang-format on
+
+        // the points of a keyframe are indexed by gl_VertexID,
+        // see vtkF3DPolyDataMapper::SetCustomUniforms
+        posImpl += "  if (keyframeNumberOfPoints > 0)\n"
+                   "  {\n"
+                   "    posMC = vec4(mix(decodeKeyframePosition(keyframeFirst),\n"
+                   "      decodeKeyframePosition(keyframeSecond), keyframeFactor), 1.0);\n"
+                   "  }\n";
+
+        if (hasNormals && vtkF3DVertexAnimation::GetVertexAnimation(polyData)->GetHasNormals())
+        {
+          normalImpl +=
+            "  if (keyframeNumberOfPoints > 0)\n"
+            "  {\n"
+            "    normalVCVSOutput = normalize(mix(decodeKeyframeNormal(keyframeFirst),\n"
+            "      decodeKeyframeNormal(keyframeSecond), keyframeFactor));\n"
+            "  }\n";
+        }
+      }
+
+      // morphing, any number of targets are fetched from texture buffers with the targets
+      // applied this frame, see vtkF3DPolyDataMapper
+      if (hasMorphing && vtkF3DPolyDataMapper::UseMorphTargetsBuffer(actor, polyData))
+      {
+        customDecl += "uniform samplerBuffer morphTargetPositions;\n"
+                      "uniform samplerBuffer morphTargetNormals;\n"
+                      "uniform samplerBuffer morphActiveTargets;\n"
+                      "uniform int morphActiveCount;\n"
+                      "uniform int morphNumberOfPoints;\n";
+
+        // each active target texel stores the target index and its weight, the targets of a
+        // point being indexed by gl_VertexID, see vtkF3DPolyDataMapper::SetCustomUniforms
+        posImpl += "  for (int i = 0; i < morphActiveCount; i++)\n"
+                   "  {\n"
+                   "    vec2 target = texelFetch(morphActiveTargets, i).xy;\n"
+                   "    int texel = int(target.x) * morphNumberOfPoints + gl_VertexID;\n"
+                   "    posMC += target.y * vec4(texelFetch(morphTargetPositions, texel).xyz, 0);\n"
+                   "  }\n";
+
+        if (hasNormals)
+        {
+          normalImpl +=
+            "  for (int i = 0; i < morphActiveCount; i++)\n"
+            "  {\n"
+            "    vec2 target = texelFetch(morphActiveTargets, i).xy;\n"
+            "    int texel = int(target.x) * morphNumberOfPoints + gl_VertexID;\n"
+            "    normalVCVSOutput += target.y * texelFetch(morphTargetNormals, texel).xyz;\n"
+            "  }\n";
+        }
+      }
+      else if (hasMorphing)
+      {
+        for (int i = 0; i < vtkF3DPolyDataMapper::MaximumAttributeMorphTargets; i++)
         {
           std::string name = "target" + std::to_string(i) + "_position";
 
@@ -546,11 +694,33 @@ void vtkF3DRenderPass::ReplaceSkinningMorphing(
                      "  ivec4 currentJoints = ivec4(joints);\n";
 #endif
 
+        // large joint palettes are fetched from a texture buffer storing a column per texel,
+        // see vtkF3DPolyDataMapper
+        std::string jointMatrix = "jointMatrices[currentJoints.%]";
+        if (vtkF3DPolyDataMapper::UseJointMatricesBuffer(actor))
+        {
+          customDecl += "uniform samplerBuffer jointMatricesBuffer;\n"
+                        "mat4 fetchJointMatrix(int joint)\n"
+                        "{\n"
+                        "  return mat4(texelFetch(jointMatricesBuffer, 4 * joint),\n"
+                        "    texelFetch(jointMatricesBuffer, 4 * joint + 1),\n"
+                        "    texelFetch(jointMatricesBuffer, 4 * joint + 2),\n"
+                        "    texelFetch(jointMatricesBuffer, 4 * joint + 3));\n"
+                        "}\n";
+          jointMatrix = "fetchJointMatrix(int(currentJoints.%))";
+        }
+
         // compute skinning matrix with current uniform weights
-        beginImpl += "  mat4 skinMat = currentWeight.x * jointMatrices[currentJoints.x]\n"
-                     "               + currentWeight.y * jointMatrices[currentJoints.y]\n"
-                     "               + currentWeight.z * jointMatrices[currentJoints.z]\n"
-                     "               + currentWeight.w * jointMatrices[currentJoints.w];\n";
+        auto weightedJoint = [&](const std::string& component)
+        {
+          std::string joint = jointMatrix;
+          joint.replace(joint.find('%'), 1, component);
+          return "currentWeight." + component + " * " + joint;
+        };
+        beginImpl += "  mat4 skinMat = " + weightedJoint("x") + "\n" +
+          "               + " + weightedJoint("y") + "\n" +
+          "               + " + weightedJoint("z") + "\n" +
+          "               + " + weightedJoint("w") + ";\n";
 
         posImpl += "  posMC = skinMat * posMC;\n";
 
@@ -778,9 +948,21 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
       }
     }
 
+    // only submit the props intersecting the camera frustum, the raytracer needs all of them
+    // for shadows and reflections
+    this->VisibleMainProps = this->MainProps;
+#if F3D_MODULE_RAYTRACING
+    if (!this->UseRaytracing)
+#endif
+    {
+      this->FrustumCuller.Cull(r, this->MainProps, this->NonCullableProps, this->VisibleMainProps);
+    }
+    this->NumberOfCulledProps =
+      static_cast<int>(this->MainProps.size() - this->VisibleMainProps.size());
+
     vtkRenderState mainState(s->GetRenderer());
     mainState.SetPropArrayAndCount(
-      this->MainProps.data(), static_cast<int>(this->MainProps.size()));
+      this->VisibleMainProps.data(), static_cast<int>(this->VisibleMainProps.size()));
     mainState.SetFrameBuffer(s->GetFrameBuffer());
 
     this->MainPass->Render(&mainState);
@@ -803,6 +985,33 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
   this->PostRender(s);
 }
 
+// ----------------------------------------------------------------------------
+int vtkF3DRenderPass::GetNumberOfMainProps() const
+{
+  return static_cast<int>(this->MainProps.size());
+}
+
+// ----------------------------------------------------------------------------
+int vtkF3DRenderPass::GetNumberOfCulledProps() const
+{
+  return this->NumberOfCulledProps;
+}
+
+// ----------------------------------------------------------------------------
+bool vtkF3DRenderPass::IsTemporalAccumulationConverged() const
+{
+  return !this->TAAPass || this->TAAPass->IsConverged();
+}
+
+// ----------------------------------------------------------------------------
+void vtkF3DRenderPass::ResetTemporalAccumulation()
+{
+  if (this->TAAPass)
+  {
+    this->TAAPass->ResetIterations();
+  }
+}
+
 // ----------------------------------------------------------------------------
 void vtkF3DRenderPass::Blend(const vtkRenderState* s)
 {
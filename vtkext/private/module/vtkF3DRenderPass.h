@@ -15,12 +15,15 @@
 #ifndef vtkF3DRenderPass_h
 #define vtkF3DRenderPass_h
 
+#include "F3DFrustumCuller.h"
+
 #include <vtkFramebufferPass.h>
 #include <vtkOpenGLQuadHelper.h>
 #include <vtkOpenGLRenderPass.h>
 #include <vtkSmartPointer.h>
 #include <vtkTimeStamp.h>
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -28,9 +31,12 @@ class vtkActor;
 class vtkCamera;
 class vtkInformationIntegerKey;
 class vtkAbstractMapper;
+class vtkF3DHexagonalBokehBlurPass;
+class vtkF3DTAAPass;
 class vtkPolyData;
 class vtkMatrix4x4;
 class vtkProp;
+class vtkSSAOPass;
 
 class vtkF3DRenderPass : public vtkOpenGLRenderPass
 {
@@ -49,6 +55,7 @@ public:
   vtkSetVector6Macro(Bounds, double);
   vtkSetMacro(CircleOfConfusionRadius, double);
   vtkSetMacro(RenderReflection, bool);
+  vtkSetMacro(UseTemporalAntiAliasing, bool);
 
   /**
    * Modify shader code for matcap/gamma/skinning
@@ -63,6 +70,26 @@ public:
 
   static vtkInformationIntegerKey* RENDER_UI_ONLY();
 
+  /**
+   * Return true if the temporal anti-aliasing accumulation has converged,
+   * or if temporal anti-aliasing is not used.
+   */
+  bool IsTemporalAccumulationConverged() const;
+
+  /**
+   * Restart the temporal anti-aliasing accumulation, if used.
+   */
+  void ResetTemporalAccumulation();
+
+  ///@{
+  /**
+   * Get the number of main props and the number of them that were outside of the camera frustum
+   * and not rendered during the last render. Props are not culled when raytracing.
+   */
+  int GetNumberOfMainProps() const;
+  int GetNumberOfCulledProps() const;
+  ///@}
+
 protected:
   vtkF3DRenderPass() = default;
   ~vtkF3DRenderPass() override = default;
@@ -73,6 +100,11 @@ protected:
 
   void Blend(const vtkRenderState* s);
 
+  /**
+   * Provide the reflection textures to the grid mappers of the main props.
+   */
+  void ConfigureGridReflection();
+
   void ReflectCamera(vtkCamera* originalCam, vtkMatrix4x4* actorMatrix, vtkCamera* reflectedCam);
 
   bool ArmatureVisible = false;
@@ -81,6 +113,7 @@ protected:
   bool UseBlurBackground = false;
   bool ForceOpaqueBackground = false;
   bool RenderReflection = false;
+  bool UseTemporalAntiAliasing = false;
 
   double CircleOfConfusionRadius = 20.0;
 
@@ -88,6 +121,13 @@ protected:
   vtkSmartPointer<vtkFramebufferPass> BakeReflectionPass;
   vtkSmartPointer<vtkFramebufferPass> MainPass;
   vtkSmartPointer<vtkFramebufferPass> MainOnTopPass;
+  vtkSmartPointer<vtkF3DTAAPass> TAAPass;
+  vtkSmartPointer<vtkF3DHexagonalBokehBlurPass> BlurPass;
+  vtkSmartPointer<vtkSSAOPass> SSAOPass;
+
+  // Options the passes were built with, the passes are only rebuilt when one of them changes:
+  // raytracing, SSAO, background blur, TAA and blending mode
+  std::array<int, 5> PassesStructure = { -1, -1, -1, -1, -1 };
 
   double Bounds[6] = {};
 
@@ -100,6 +140,12 @@ protected:
   std::vector<vtkProp*> MainProps;
   std::vector<vtkProp*> ReflectionProps;
 
+  // Main props deformed on the GPU whose bounds cannot be trusted for culling
+  std::vector<vtkProp*> NonCullableProps;
+  std::vector<vtkProp*> VisibleMainProps;
+  F3DFrustumCuller FrustumCuller;
+  int NumberOfCulledProps = 0;
+
   std::shared_ptr<vtkOpenGLQuadHelper> BlendQuadHelper;
 
 private:
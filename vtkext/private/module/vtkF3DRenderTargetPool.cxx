@@ -0,0 +1,201 @@
+#include "vtkF3DRenderTargetPool.h"
+
+#include "F3DLog.h"
+
+#include <vtkInformation.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkTextureObject.h>
+#include <vtk_glad.h>
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+namespace
+{
+// Number of frames a released texture is kept without being acquired
+constexpr unsigned int MaxUnusedFrames = 16;
+
+//----------------------------------------------------------------------------
+size_t GetBytesPerPixel(vtkF3DRenderTargetPool::Format format)
+{
+  switch (format)
+  {
+    case vtkF3DRenderTargetPool::Format::RGBA8:
+    case vtkF3DRenderTargetPool::Format::Depth32F:
+      return 4;
+    case vtkF3DRenderTargetPool::Format::RGB16F:
+      return 6;
+    case vtkF3DRenderTargetPool::Format::RGBA16F:
+      return 8;
+    case vtkF3DRenderTargetPool::Format::RGBA32F:
+      return 16;
+  }
+  return 0;
+}
+}
+
+vtkStandardNewMacro(vtkF3DRenderTargetPool);
+vtkInformationKeyMacro(vtkF3DRenderTargetPool, RENDER_TARGET_POOL, ObjectBase);
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderTargetPool::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfTextures: " << this->GetNumberOfTextures() << "\n";
+  os << indent << "AllocatedMemory: " << this->GetAllocatedMemory() << "\n";
+}
+
+//----------------------------------------------------------------------------
+vtkF3DRenderTargetPool* vtkF3DRenderTargetPool::GetPool(vtkRenderer* renderer)
+{
+  vtkInformation* info = renderer->GetInformation();
+  vtkF3DRenderTargetPool* pool =
+    vtkF3DRenderTargetPool::SafeDownCast(info->Get(vtkF3DRenderTargetPool::RENDER_TARGET_POOL()));
+  if (!pool)
+  {
+    vtkNew<vtkF3DRenderTargetPool> newPool;
+    info->Set(vtkF3DRenderTargetPool::RENDER_TARGET_POOL(), newPool);
+    pool = newPool;
+  }
+  return pool;
+}
+
+//----------------------------------------------------------------------------
+vtkTextureObject* vtkF3DRenderTargetPool::Acquire(
+  vtkOpenGLRenderWindow* renWin, int width, int height, Format format)
+{
+  for (Entry& entry : this->Entries)
+  {
+    if (!entry.Acquired && entry.Width == width && entry.Height == height &&
+      entry.TextureFormat == format && entry.Texture->GetContext() == renWin)
+    {
+      entry.Acquired = true;
+      entry.LastFrame = this->Frame;
+      return entry.Texture;
+    }
+  }
+
+  vtkNew<vtkTextureObject> texture;
+  texture->SetContext(renWin);
+  if (format == Format::Depth32F)
+  {
+    texture->AllocateDepth(width, height, vtkTextureObject::Float32);
+  }
+  else
+  {
+    texture->SetMinificationFilter(vtkTextureObject::Linear);
+    texture->SetMagnificationFilter(vtkTextureObject::Linear);
+    texture->SetWrapS(vtkTextureObject::ClampToEdge);
+    texture->SetWrapT(vtkTextureObject::ClampToEdge);
+    switch (format)
+    {
+      case Format::RGB16F:
+        texture->SetFormat(GL_RGB);
+        texture->SetInternalFormat(GL_RGB16F);
+        texture->SetDataType(GL_HALF_FLOAT);
+        texture->Allocate2D(width, height, 3, VTK_FLOAT);
+        break;
+      case Format::RGBA16F:
+        texture->SetFormat(GL_RGBA);
+        texture->SetInternalFormat(GL_RGBA16F);
+        texture->SetDataType(GL_HALF_FLOAT);
+        texture->Allocate2D(width, height, 4, VTK_FLOAT);
+        break;
+      case Format::RGBA32F:
+        texture->SetFormat(GL_RGBA);
+        texture->SetInternalFormat(GL_RGBA32F);
+        texture->SetDataType(GL_FLOAT);
+        texture->Allocate2D(width, height, 4, VTK_FLOAT);
+        break;
+      default:
+        texture->SetFormat(GL_RGBA);
+        texture->SetInternalFormat(GL_RGBA8);
+        texture->SetDataType(GL_UNSIGNED_BYTE);
+        texture->Allocate2D(width, height, 4, VTK_UNSIGNED_CHAR);
+        break;
+    }
+  }
+
+  this->Entries.push_back({ texture, width, height, format, true, this->Frame });
+  this->ReportMemory();
+  return texture;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderTargetPool::Release(vtkTextureObject* texture)
+{
+  auto it = std::find_if(this->Entries.begin(), this->Entries.end(),
+    [texture](const Entry& entry) { return entry.Texture == texture; });
+  if (it == this->Entries.end() || !it->Acquired)
+  {
+    vtkWarningMacro("Releasing a texture that was not acquired from this pool");
+    return;
+  }
+  it->Acquired = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderTargetPool::BeginFrame()
+{
+  this->Frame++;
+
+  const size_t count = this->Entries.size();
+  auto unused = [this](const Entry& entry)
+  { return !entry.Acquired && this->Frame - entry.LastFrame > ::MaxUnusedFrames; };
+  this->Entries.erase(
+    std::remove_if(this->Entries.begin(), this->Entries.end(), unused), this->Entries.end());
+
+  if (this->Entries.size() != count)
+  {
+    this->ReportMemory();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderTargetPool::ReleaseGraphicsResources(vtkWindow* window)
+{
+  for (Entry& entry : this->Entries)
+  {
+    entry.Texture->ReleaseGraphicsResources(window);
+  }
+  this->Entries.clear();
+  this->ReportMemory();
+}
+
+//----------------------------------------------------------------------------
+size_t vtkF3DRenderTargetPool::GetNumberOfTextures() const
+{
+  return this->Entries.size();
+}
+
+//----------------------------------------------------------------------------
+size_t vtkF3DRenderTargetPool::GetAllocatedMemory() const
+{
+  return std::accumulate(this->Entries.begin(), this->Entries.end(), size_t(0),
+    [](size_t sum, const Entry& entry)
+    {
+      return sum +
+        static_cast<size_t>(entry.Width) * entry.Height * ::GetBytesPerPixel(entry.TextureFormat);
+    });
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderTargetPool::ReportMemory()
+{
+  const size_t memory = this->GetAllocatedMemory();
+  if (memory == this->ReportedMemory)
+  {
+    return;
+  }
+  this->ReportedMemory = memory;
+
+  std::stringstream stream;
+  stream << "Render target pool: " << this->Entries.size() << " textures, "
+         << memory / (1024.0 * 1024.0) << " MiB";
+  F3DLog::Print(F3DLog::Severity::Debug, stream.str());
+}
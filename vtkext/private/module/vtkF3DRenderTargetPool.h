@@ -0,0 +1,117 @@
+/**
+ * @class   vtkF3DRenderTargetPool
+ * @brief   A pool of transient textures shared by the render passes of a renderer
+ *
+ * Render passes acquire the textures they render into for the duration of their Render call
+ * and release them once their result has been consumed. A released texture is handed out again
+ * to the next pass asking for the same size and format, in the same frame or in a later one,
+ * so passes whose textures are not used at the same time alias the same memory and the
+ * full quality and interactive chains share their textures.
+ * Textures that were not acquired for a few frames, eg: after a resize, are deleted.
+ * The pool of a renderer is stored in its information and created on first use.
+ */
+
+#ifndef vtkF3DRenderTargetPool_h
+#define vtkF3DRenderTargetPool_h
+
+#include <vtkObject.h>
+#include <vtkSmartPointer.h>
+
+#include <vector>
+
+class vtkInformationObjectBaseKey;
+class vtkOpenGLRenderWindow;
+class vtkRenderer;
+class vtkTextureObject;
+class vtkWindow;
+
+class vtkF3DRenderTargetPool : public vtkObject
+{
+public:
+  static vtkF3DRenderTargetPool* New();
+  vtkTypeMacro(vtkF3DRenderTargetPool, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Formats of the pooled textures.
+   */
+  enum class Format : unsigned char
+  {
+    RGBA8,
+    RGB16F,
+    RGBA16F,
+    RGBA32F,
+    Depth32F
+  };
+
+  /**
+   * Get the pool of the provided renderer, creating it if needed.
+   */
+  static vtkF3DRenderTargetPool* GetPool(vtkRenderer* renderer);
+
+  /**
+   * Key used to store the pool in the renderer information.
+   */
+  static vtkInformationObjectBaseKey* RENDER_TARGET_POOL();
+
+  /**
+   * Get a texture of the provided size and format, allocating it if no released texture
+   * matches. Color textures are configured with linear filtering and clamp to edge wrapping.
+   * The texture must be given back with Release once its content is not needed anymore.
+   */
+  vtkTextureObject* Acquire(vtkOpenGLRenderWindow* renWin, int width, int height, Format format);
+
+  /**
+   * Give back a texture acquired from this pool so it can be used by another pass.
+   */
+  void Release(vtkTextureObject* texture);
+
+  /**
+   * Mark the start of a new frame.
+   * Released textures that were not acquired during the last frames are deleted.
+   */
+  void BeginFrame();
+
+  /**
+   * Release the graphics resources of all the textures and clear the pool.
+   * Must not be called while a texture is acquired.
+   */
+  void ReleaseGraphicsResources(vtkWindow* window);
+
+  ///@{
+  /**
+   * Get the number of textures and the GPU memory in bytes currently allocated by the pool.
+   */
+  size_t GetNumberOfTextures() const;
+  size_t GetAllocatedMemory() const;
+  ///@}
+
+protected:
+  vtkF3DRenderTargetPool() = default;
+  ~vtkF3DRenderTargetPool() override = default;
+
+private:
+  vtkF3DRenderTargetPool(const vtkF3DRenderTargetPool&) = delete;
+  void operator=(const vtkF3DRenderTargetPool&) = delete;
+
+  /**
+   * Log the memory used by the pool when it changed.
+   */
+  void ReportMemory();
+
+  struct Entry
+  {
+    vtkSmartPointer<vtkTextureObject> Texture;
+    int Width;
+    int Height;
+    Format TextureFormat;
+    bool Acquired;
+    unsigned int LastFrame;
+  };
+
+  std::vector<Entry> Entries;
+  unsigned int Frame = 0;
+  size_t ReportedMemory = 0;
+};
+
+#endif
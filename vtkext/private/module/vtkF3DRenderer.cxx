@@ -15,6 +15,8 @@
 #include "vtkF3DPointSplatUtilsSDF.h"
 #include "vtkF3DPolyDataMapper.h"
 #include "vtkF3DRenderPass.h"
+#include "vtkF3DRenderTargetPool.h"
+#include "vtkF3DShaderCache.h"
 #include "vtkF3DSolidBackgroundPass.h"
 #include "vtkF3DUserRenderPass.h"
 
@@ -36,6 +38,9 @@
 #include <vtkImageData.h>
 #include <vtkImageReader2.h>
 #include <vtkImageReader2Factory.h>
+#include <vtkImageShrink3D.h>
+#include <vtkInformation.h>
+#include <vtkInformationIntegerKey.h>
 #include <vtkLight.h>
 #include <vtkLightCollection.h>
 #include <vtkLightKit.h>
@@ -89,6 +94,10 @@
 #include "F3DStyle.h"
 #endif
 
+#if F3D_MODULE_EXR
+#include "vtkF3DEXRReader.h"
+#endif
+
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
 #include <vtkMemoryResourceStream.h>
 #endif
@@ -105,6 +114,7 @@
 #include <chrono>
 #include <numbers>
 #include <sstream>
+#include <type_traits>
 
 namespace
 {
@@ -113,6 +123,9 @@ constexpr double ScalarBarPositionX = 0.1;
 constexpr double ScalarBarPositionY = 0.01;
 constexpr double ScalarBarHeight = 0.07;
 
+// Maximum width of the HDRI texture when it is only used for image based lighting
+constexpr int ReducedHDRIMaximumWidth = 2048;
+
 std::string DeprecatedCollapsePath(const fs::path& path)
 {
   std::string collapsed;
@@ -264,13 +277,17 @@ vtkF3DRenderer::~vtkF3DRenderer() = default;
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ReleaseGraphicsResources(vtkWindow* w)
 {
-  if (this->Timer != 0)
+  for (FrameTimer& timer : this->FrameTimers)
   {
-    glDeleteQueries(1, &this->Timer);
-    this->Timer = 0;
+    if (timer.Query != 0)
+    {
+      glDeleteQueries(1, &timer.Query);
+    }
+    timer = FrameTimer();
   }
 
   this->UIActor->ReleaseGraphicsResources(w);
+  vtkF3DRenderTargetPool::GetPool(this)->ReleaseGraphicsResources(w);
 
   this->Superclass::ReleaseGraphicsResources(w);
 }
@@ -469,83 +486,99 @@ void vtkF3DRenderer::ConfigureUpDirection()
 }
 
 //----------------------------------------------------------------------------
-void vtkF3DRenderer::ConfigureRenderPasses()
+void vtkF3DRenderer::CreateRenderPasses(bool interactive, RenderPassNodes& nodes)
 {
-  // clean up previous pass
-  vtkRenderPass* pass = this->GetPass();
-  if (pass)
-  {
-    pass->ReleaseGraphicsResources(this->RenderWindow);
-  }
+  RenderPassNodes previous = std::move(nodes);
+  nodes = RenderPassNodes();
 
-  vtkNew<vtkF3DRenderPass> newPass;
-#if F3D_MODULE_RAYTRACING
-  newPass->SetUseRaytracing(this->UseRaytracing);
-#endif
-  newPass->SetUseSSAOPass(this->UseSSAOPass);
-  newPass->SetUseBlurBackground(this->UseBlurBackground);
-  newPass->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
-  newPass->SetForceOpaqueBackground(this->HDRISkyboxVisible);
-  newPass->SetArmatureVisible(this->ArmatureVisible);
-  newPass->SetRenderReflection(this->GridVisible && this->GridReflection > 0.0);
-
-  double bounds[6];
-  this->ComputeVisiblePropBounds(bounds);
-  newPass->SetBounds(bounds);
-
-  // Image post processing passes
-  vtkSmartPointer<vtkRenderPass> renderingPass = newPass;
+  // Keep the previous node if any so its graphics resources are not recreated
+  auto reuse = [](auto& previousNode, auto& node)
+  {
+    using PassType = typename std::decay_t<decltype(node)>::element_type;
+    node = previousNode ? previousNode : vtkSmartPointer<PassType>::New();
+    previousNode = nullptr;
+  };
 
+  vtkSmartPointer<vtkRenderPass> renderingPass;
   if (this->DisplayDepth)
   {
     // discard vtkF3DRenderPass if displaying depth
-    vtkNew<vtkOpaquePass> opaqueP;
-    vtkNew<vtkCameraPass> camP;
-    vtkNew<vtkF3DDisplayDepthRenderPass> depthP;
-    camP->SetDelegatePass(opaqueP);
-    depthP->SetDelegatePass(camP);
+    const bool created = !previous.DisplayDepth;
+    reuse(previous.DisplayDepth, nodes.DisplayDepth);
+    if (created)
+    {
+      vtkNew<vtkOpaquePass> opaqueP;
+      vtkNew<vtkCameraPass> camP;
+      camP->SetDelegatePass(opaqueP);
+      nodes.DisplayDepth->SetDelegatePass(camP);
+    }
     if (this->EnableColoring)
     {
       this->ConfigureColoringAndVisibilities();
-      depthP->SetColorMap(this->ColorTransferFunction);
+      nodes.DisplayDepth->SetColorMap(this->ColorTransferFunction);
+    }
+    else
+    {
+      nodes.DisplayDepth->SetColorMap(nullptr);
     }
-    renderingPass = depthP;
+    renderingPass = nodes.DisplayDepth;
+  }
+  else
+  {
+    reuse(previous.Main, nodes.Main);
+    vtkF3DRenderPass* mainPass = nodes.Main;
+#if F3D_MODULE_RAYTRACING
+    mainPass->SetUseRaytracing(this->UseRaytracing);
+#endif
+    mainPass->SetUseSSAOPass(this->UseSSAOPass && !interactive);
+    mainPass->SetUseBlurBackground(this->UseBlurBackground && !interactive);
+    mainPass->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
+    mainPass->SetForceOpaqueBackground(this->HDRISkyboxVisible);
+    mainPass->SetArmatureVisible(this->ArmatureVisible);
+    mainPass->SetRenderReflection(
+      this->GridVisible && this->GridReflection > 0.0 && !interactive);
+    mainPass->SetUseTemporalAntiAliasing(
+      this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::TAA && !interactive);
+
+    double bounds[6];
+    this->ComputeVisiblePropBounds(bounds);
+    mainPass->SetBounds(bounds);
+    renderingPass = nodes.Main;
   }
 
-  if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA)
+  // Image post processing passes
+  if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA && !interactive)
   {
-    vtkNew<vtkSSAAPass> ssaaP;
+    reuse(previous.SSAA, nodes.SSAA);
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 4, 20250329)
-    ssaaP->SetColorFormat(vtkTextureObject::Float16);
+    nodes.SSAA->SetColorFormat(vtkTextureObject::Float16);
 #endif
-    ssaaP->SetDelegatePass(renderingPass);
-    renderingPass = ssaaP;
+    nodes.SSAA->SetDelegatePass(renderingPass);
+    renderingPass = nodes.SSAA;
   }
 
   if (this->UseToneMappingPass)
   {
-    vtkNew<vtkToneMappingPass> toneP;
-    toneP->SetToneMappingType(vtkToneMappingPass::NeutralPBR);
-    toneP->SetDelegatePass(renderingPass);
-    renderingPass = toneP;
+    reuse(previous.ToneMapping, nodes.ToneMapping);
+    nodes.ToneMapping->SetToneMappingType(vtkToneMappingPass::NeutralPBR);
+    nodes.ToneMapping->SetDelegatePass(renderingPass);
+    renderingPass = nodes.ToneMapping;
   }
 
   if (!this->HDRISkyboxVisible)
   {
     // if the background is transparent, we need to blend the result to the RGB background
     // before it goes through the next passes
-    vtkNew<vtkF3DSolidBackgroundPass> bgPass;
-    bgPass->SetDelegatePass(renderingPass);
-    renderingPass = bgPass;
+    reuse(previous.SolidBackground, nodes.SolidBackground);
+    nodes.SolidBackground->SetDelegatePass(renderingPass);
+    renderingPass = nodes.SolidBackground;
   }
 
   if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::FXAA)
   {
-    vtkNew<vtkOpenGLFXAAPass> fxaaP;
-    fxaaP->SetDelegatePass(renderingPass);
-
-    this->SetPass(fxaaP);
-    renderingPass = fxaaP;
+    reuse(previous.FXAA, nodes.FXAA);
+    nodes.FXAA->SetDelegatePass(renderingPass);
+    renderingPass = nodes.FXAA;
   }
 
   if (this->FinalShader.has_value())
@@ -553,10 +586,10 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     // basic validation
     if (this->FinalShader.value().find("pixel") != std::string::npos)
     {
-      vtkNew<vtkF3DUserRenderPass> userP;
-      userP->SetUserShader(this->FinalShader.value().c_str());
-      userP->SetDelegatePass(renderingPass);
-      renderingPass = userP;
+      reuse(previous.User, nodes.User);
+      nodes.User->SetUserShader(this->FinalShader.value().c_str());
+      nodes.User->SetDelegatePass(renderingPass);
+      renderingPass = nodes.User;
     }
     else
     {
@@ -565,10 +598,68 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     }
   }
 
-  vtkNew<vtkF3DOverlayRenderPass> overlayP;
-  overlayP->SetDelegatePass(renderingPass);
+  reuse(previous.Overlay, nodes.Overlay);
+  nodes.Overlay->SetDelegatePass(renderingPass);
+
+  // Nodes that are not part of the new chain anymore
+  this->ReleaseRenderPasses(previous);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ReleaseRenderPasses(RenderPassNodes& nodes)
+{
+  // Image processing passes release their delegate, detach them first so the resources of
+  // passes still used by another chain are not released
+  auto release = [this](auto& node)
+  {
+    if (node)
+    {
+      node->SetDelegatePass(nullptr);
+      node->ReleaseGraphicsResources(this->RenderWindow);
+      node = nullptr;
+    }
+  };
+
+  release(nodes.Overlay);
+  release(nodes.User);
+  release(nodes.FXAA);
+  release(nodes.SolidBackground);
+  release(nodes.ToneMapping);
+  release(nodes.SSAA);
+  release(nodes.DisplayDepth);
+
+  if (nodes.Main)
+  {
+    nodes.Main->ReleaseGraphicsResources(this->RenderWindow);
+    nodes.Main = nullptr;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ConfigureRenderPasses()
+{
+  // Passes are updated in place, only the nodes that are not needed anymore are released
+  this->CreateRenderPasses(false, this->FullQualityNodes);
+  this->FullQualityPass = this->FullQualityNodes.Overlay;
+  this->MainRenderPass = this->FullQualityNodes.Main;
+
+  // The interactive chain is only needed if it is cheaper than the full quality one
+  if (this->UseProgressiveRendering && !this->UseRaytracing &&
+    (this->UseSSAOPass || this->UseBlurBackground ||
+      (this->GridVisible && this->GridReflection > 0.0) ||
+      this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA ||
+      this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::TAA))
+  {
+    this->CreateRenderPasses(true, this->InteractiveNodes);
+    this->InteractivePass = this->InteractiveNodes.Overlay;
+  }
+  else
+  {
+    this->ReleaseRenderPasses(this->InteractiveNodes);
+    this->InteractivePass = nullptr;
+  }
 
-  this->SetPass(overlayP);
+  this->SetPass(this->FullQualityPass);
 
 #if F3D_MODULE_RAYTRACING
   vtkOSPRayRendererNode::SetRendererType("pathtracer", this);
@@ -1191,6 +1282,15 @@ void vtkF3DRenderer::SetCachePath(const std::string& cachePath)
     {
       this->CreateCacheDirectory();
     }
+
+    // Store the shader program binaries alongside the HDRI caches
+    vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(this->RenderWindow);
+    vtkF3DShaderCache* shaderCache =
+      renWin ? vtkF3DShaderCache::SafeDownCast(renWin->GetShaderCache()) : nullptr;
+    if (shaderCache)
+    {
+      shaderCache->SetCachePath(cachePath.empty() ? cachePath : cachePath + "/shaders");
+    }
   }
 }
 
@@ -1198,7 +1298,8 @@ void vtkF3DRenderer::SetCachePath(const std::string& cachePath)
 bool vtkF3DRenderer::CheckForSHCache(std::string& path)
 {
   assert(this->HasValidHDRIHash);
-  path = this->CachePath + "/" + this->HDRIHash + "/sh.vtt";
+  path = this->CachePath + "/" + this->HDRIHash +
+    (this->HDRITextureReduced ? "/sh_reduced.vtt" : "/sh.vtt");
   return vtksys::SystemTools::FileExists(path, true);
 }
 
@@ -1206,7 +1307,8 @@ bool vtkF3DRenderer::CheckForSHCache(std::string& path)
 bool vtkF3DRenderer::CheckForSpecCache(std::string& path)
 {
   assert(this->HasValidHDRIHash);
-  path = this->CachePath + "/" + this->HDRIHash + "/specular.vtm";
+  path = this->CachePath + "/" + this->HDRIHash +
+    (this->HDRITextureReduced ? "/specular_reduced.vtm" : "/specular.vtm");
   return vtksys::SystemTools::FileExists(path, true);
 }
 
@@ -1323,8 +1425,34 @@ void vtkF3DRenderer::ConfigureHDRIHash()
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::ConfigureHDRITexture()
 {
-  if (!this->HasValidHDRITexture)
+  // The skybox and the raytracing background are the only ones needing the full resolution
+  const bool needFullResolution = this->HDRISkyboxVisible || this->UseRaytracing;
+  if (!this->HasValidHDRITexture || (this->HDRITextureReduced && needFullResolution))
   {
+    // Read the image size first, as the cached lighting depends on the texture it is computed from
+    this->HDRITextureReduced = false;
+    if (this->HasValidHDRIReader)
+    {
+#if F3D_MODULE_EXR
+      // Tiled EXR files can be read directly from a reduced mipmap level
+      vtkF3DEXRReader* exrReader = vtkF3DEXRReader::SafeDownCast(this->HDRIReader);
+      if (exrReader)
+      {
+        exrReader->SetMaximumWidth(needFullResolution ? 0 : ::ReducedHDRIMaximumWidth);
+      }
+#endif
+      this->HDRIReader->UpdateInformation();
+      const int* extent = this->HDRIReader->GetDataExtent();
+      this->HDRITextureReduced =
+        !needFullResolution && extent[1] - extent[0] + 1 > ::ReducedHDRIMaximumWidth;
+#if F3D_MODULE_EXR
+      if (exrReader && exrReader->GetLevel() > 0)
+      {
+        this->HDRITextureReduced = true;
+      }
+#endif
+    }
+
     bool needHDRITexture = this->HDRISkyboxVisible || this->GetUseImageBasedLighting();
 
     if (this->HasValidHDRIHash)
@@ -1340,6 +1468,21 @@ void vtkF3DRenderer::ConfigureHDRITexture()
     {
       assert(this->HasValidHDRIReader);
       this->HDRIReader->Update();
+      vtkSmartPointer<vtkAlgorithm> source = this->HDRIReader;
+
+      // Spherical harmonics and prefiltered specular do not need a large texture,
+      // pixels are averaged as it does not introduce ringing around bright light sources
+      int* dims = this->HDRIReader->GetOutput()->GetDimensions();
+      if (!needFullResolution && dims[0] > ::ReducedHDRIMaximumWidth)
+      {
+        const int factor = (dims[0] + ::ReducedHDRIMaximumWidth - 1) / ::ReducedHDRIMaximumWidth;
+        vtkNew<vtkImageShrink3D> shrink;
+        shrink->SetInputConnection(this->HDRIReader->GetOutputPort());
+        shrink->SetShrinkFactors(factor, factor, 1);
+        shrink->AveragingOn();
+        shrink->Update();
+        source = shrink;
+      }
 
       this->HDRITexture = vtkSmartPointer<vtkTexture>::New();
       this->HDRITexture->SetColorModeToDirectScalars();
@@ -1348,7 +1491,7 @@ void vtkF3DRenderer::ConfigureHDRITexture()
 
 #ifdef F3D_USE_GLES
       // with OpenGL ES, we need to add an alpha channel because RGB32F is not filterable
-      vtkImageData* rgb = this->HDRIReader->GetOutput();
+      vtkImageData* rgb = vtkImageData::SafeDownCast(source->GetOutputDataObject(0));
 
       if (rgb->GetNumberOfScalarComponents() == 3 && rgb->GetScalarType() == VTK_FLOAT)
       {
@@ -1366,10 +1509,10 @@ void vtkF3DRenderer::ConfigureHDRITexture()
       }
       else
       {
-        this->HDRITexture->SetInputConnection(this->HDRIReader->GetOutputPort());
+        this->HDRITexture->SetInputConnection(source->GetOutputPort());
       }
 #else
-      this->HDRITexture->SetInputConnection(this->HDRIReader->GetOutputPort());
+      this->HDRITexture->SetInputConnection(source->GetOutputPort());
 #endif
 
       // 8-bit textures are usually gamma-corrected
@@ -1769,6 +1912,31 @@ void vtkF3DRenderer::SetUseBlurBackground(bool use)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetUseProgressiveRendering(bool use)
+{
+  if (this->UseProgressiveRendering != use)
+  {
+    this->UseProgressiveRendering = use;
+    this->RenderPassesConfigured = false;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetUseLevelOfDetail(bool use)
+{
+  // Read by vtkF3DPolyDataMapper when rendering
+  vtkInformation* info = this->GetInformation();
+  if (use)
+  {
+    info->Set(vtkF3DPolyDataMapper::USE_LEVEL_OF_DETAIL(), 1);
+  }
+  else
+  {
+    info->Remove(vtkF3DPolyDataMapper::USE_LEVEL_OF_DETAIL());
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::SetBackfaceType(const std::optional<std::string>& backfaceType)
 {
@@ -1860,6 +2028,8 @@ void vtkF3DRenderer::SetUseRaytracing(bool use)
   if (this->UseRaytracing != use)
   {
     this->UseRaytracing = use;
+    this->HDRITextureConfigured = false;
+    this->HDRISkyboxConfigured = false;
     this->RenderPassesConfigured = false;
     this->CheatSheetConfigured = false;
   }
@@ -2146,7 +2316,7 @@ void vtkF3DRenderer::UpdateActors()
   assert(this->Importer);
 
   // Handle importer changes
-  // XXX: Importer only modify itself when adding a new importer,
+  // XXX: Importer only modify itself when adding or replacing an importer,
   // not when updating at a time step
   vtkMTimeType importerMTime = this->Importer->GetMTime();
   if (importerMTime > this->ImporterTimeStamp)
@@ -2154,6 +2324,17 @@ void vtkF3DRenderer::UpdateActors()
     this->ActorsPropertiesConfigured = false;
     this->GridConfigured = false;
     this->MetaDataConfigured = false;
+
+    // Actors, point sprites and volumes may have been added or replaced
+    this->PointSpritesConfigured = false;
+    this->NormalGlyphsConfigured = false;
+    this->ColorTransferFunctionConfigured = false;
+    this->OpacityTransferFunctionConfigured = false;
+    this->ColoringMappersConfigured = false;
+    this->ColoringPointSpritesMappersConfigured = false;
+    this->VolumePropsAndMappersConfigured = false;
+    this->ScalarBarActorConfigured = false;
+    this->ColoringConfigured = false;
   }
   this->ImporterTimeStamp = importerMTime;
 
@@ -2271,25 +2452,43 @@ void vtkF3DRenderer::Render()
     this->UpdateNormalGlyphsScale();
   }
 
-  if (!this->TimerVisible)
+  // Textures of the passes not used during the last frames are released
+  vtkF3DRenderTargetPool::GetPool(this)->BeginFrame();
+
+  vtkInformation* info = this->GetInformation();
+  bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
+
+  // With progressive rendering, use the cheaper interactive passes while the camera is
+  // interacted with, but only if the full quality passes cannot hold the frame rate requested
+  // by the interactor. The full quality passes are used again as soon as interaction stops.
+  bool fullQuality = true;
+  if (this->InteractivePass && !uiOnly)
+  {
+    vtkRenderWindowInteractor* iren = this->RenderWindow->GetInteractor();
+    const double desiredRate = this->RenderWindow->GetDesiredUpdateRate();
+    const bool interacting = iren && desiredRate > iren->GetStillUpdateRate();
+    fullQuality = !interacting || this->FullQualityRenderTime * desiredRate <= 1.0;
+    this->SetPass(fullQuality ? this->FullQualityPass : this->InteractivePass);
+  }
+
+  // Frame time is measured for the fps counter and for progressive rendering
+  if (!this->TimerVisible && !this->InteractivePass)
   {
     this->Superclass::Render();
     return;
   }
 
   auto cpuStart = std::chrono::high_resolution_clock::now();
-  if (this->Timer == 0)
+  FrameTimer& timer = this->FrameTimers[this->CurrentFrameTimer];
+  if (timer.Query == 0)
   {
-    glGenQueries(1, &this->Timer);
+    glGenQueries(1, &timer.Query);
   }
 
-  vtkInformation* info = this->GetInformation();
-  bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
-
 #ifndef F3D_USE_GLES
   if (!uiOnly)
   {
-    glBeginQuery(GL_TIME_ELAPSED, this->Timer);
+    glBeginQuery(GL_TIME_ELAPSED, timer.Query);
   }
 #endif
 
@@ -2305,15 +2504,55 @@ void vtkF3DRenderer::Render()
 
 #ifndef F3D_USE_GLES
     glEndQuery(GL_TIME_ELAPSED);
-    GLint elapsed;
-    glGetQueryObjectiv(this->Timer, GL_QUERY_RESULT, &elapsed);
+    timer.Pending = true;
+    timer.FullQuality = fullQuality;
+    timer.CPUTime = elapsedTime;
+
+    // Waiting for the result of this frame query would stall the pipeline, read the query of
+    // the previous frame instead, if the GPU is done with it. Otherwise only its CPU time is used.
+    this->CurrentFrameTimer = 1 - this->CurrentFrameTimer;
+    FrameTimer& previousTimer = this->FrameTimers[this->CurrentFrameTimer];
+    if (previousTimer.Pending)
+    {
+      previousTimer.Pending = false;
+      GLint available = 0;
+      glGetQueryObjectiv(previousTimer.Query, GL_QUERY_RESULT_AVAILABLE, &available);
+      double previousTime = previousTimer.CPUTime;
+      if (available)
+      {
+        GLint elapsed;
+        glGetQueryObjectiv(previousTimer.Query, GL_QUERY_RESULT, &elapsed);
 
-    // Get min between CPU frame time and GPU frame time
-    elapsedTime = std::min(elapsedTime, elapsed * 1e-9);
+        // Get min between CPU frame time and GPU frame time
+        previousTime = std::min(previousTime, elapsed * 1e-9);
+      }
+      this->RecordFrameTime(previousTime, previousTimer.FullQuality);
+    }
+#else
+    this->RecordFrameTime(elapsedTime, fullQuality);
 #endif
 
-    this->UIActor->UpdateFpsValue(elapsedTime);
+    const vtkF3DRenderPass* mainPass =
+      fullQuality ? this->FullQualityNodes.Main : this->InteractiveNodes.Main;
+    this->UIActor->SetCullingStatistics(mainPass ? mainPass->GetNumberOfCulledProps() : 0,
+      mainPass ? mainPass->GetNumberOfMainProps() : 0);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::RecordFrameTime(double elapsedTime, bool fullQuality)
+{
+  if (fullQuality)
+  {
+    this->FullQualityRenderTime = elapsedTime;
   }
+  this->UIActor->UpdateFpsValue(elapsedTime);
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::IsRenderingInteractively() const
+{
+  return this->InteractivePass && this->Pass == this->InteractivePass;
 }
 
 //----------------------------------------------------------------------------
@@ -3817,6 +4056,27 @@ void vtkF3DRenderer::SetUIDeltaTime(double time)
   this->UIActor->SetDeltaTime(time);
 }
 
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::IsUIAnimated()
+{
+  return this->UIActor->IsAnimated();
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::IsTemporalAccumulationConverged()
+{
+  return !this->MainRenderPass || this->MainRenderPass->IsTemporalAccumulationConverged();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ResetTemporalAccumulation()
+{
+  if (this->MainRenderPass)
+  {
+    this->MainRenderPass->ResetTemporalAccumulation();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::SetConsoleBadgeEnabled(bool enabled)
 {
@@ -33,14 +33,23 @@ class vtkCameraOrientationWidget;
 class vtkColorTransferFunction;
 class vtkCornerAnnotation;
 class vtkDiscretizableColorTransferFunction;
+class vtkF3DDisplayDepthRenderPass;
 class vtkF3DOpenGLGridMapper;
+class vtkF3DOverlayRenderPass;
+class vtkF3DRenderPass;
+class vtkF3DSolidBackgroundPass;
+class vtkF3DUserRenderPass;
 class vtkGridAxesActor3D;
 class vtkImageReader2;
+class vtkOpenGLFXAAPass;
 class vtkPNGReader;
+class vtkRenderPass;
 class vtkOrientationMarkerWidget;
+class vtkSSAAPass;
 class vtkScalarBarActor;
 class vtkSkybox;
 class vtkTextActor;
+class vtkToneMappingPass;
 
 class vtkF3DRenderer : public vtkOpenGLRenderer
 {
@@ -160,12 +169,20 @@ public:
   void SetUseToneMappingPass(bool use);
   void SetDisplayDepth(bool use);
   void SetUseBlurBackground(bool use);
+  void SetUseProgressiveRendering(bool use);
+  void SetUseLevelOfDetail(bool use);
   void SetBlurCircleOfConfusionRadius(double radius);
   void SetRaytracingSamples(int samples);
   void SetBackfaceType(const std::optional<std::string>& backfaceType);
   void SetFinalShader(const std::optional<std::string>& finalShader);
   ///@}
 
+  /**
+   * Return true if the cheaper interactive render passes of progressive rendering are in use,
+   * false if the full quality ones are.
+   */
+  bool IsRenderingInteractively() const;
+
   /**
    * Set SetUseOrthographicProjection
    */
@@ -534,6 +551,21 @@ public:
    */
   void SetUIDeltaTime(double time);
 
+  /**
+   * Return true if the UI changes over time and should be rendered again
+   * even when nothing else changed, eg. when notifications are displayed.
+   */
+  bool IsUIAnimated();
+
+  ///@{
+  /**
+   * Check and restart the temporal anti-aliasing accumulation.
+   * The accumulation is considered converged when temporal anti-aliasing is not used.
+   */
+  bool IsTemporalAccumulationConverged();
+  void ResetTemporalAccumulation();
+  ///@}
+
   //@{
   /**
    * Set/Get the total application time in seconds
@@ -632,7 +664,9 @@ private:
 
   ///@{
   /**
-   * Methods to check if certain HDRI caches are available
+   * Methods to check if certain HDRI caches are available.
+   * Lighting computed from a reduced HDRI texture is cached in separate files, so that a cache
+   * always matches the texture resolution it would be computed from.
    */
   bool CheckForSpecCache(std::string& path);
   bool CheckForSHCache(std::string& path);
@@ -664,6 +698,36 @@ private:
    */
   void ConfigureRenderPasses();
 
+  /**
+   * Nodes of a chain of render passes, a null node is not part of the chain.
+   * Overlay is always the first pass of the chain.
+   */
+  struct RenderPassNodes
+  {
+    vtkSmartPointer<vtkF3DRenderPass> Main;
+    vtkSmartPointer<vtkF3DDisplayDepthRenderPass> DisplayDepth;
+    vtkSmartPointer<vtkSSAAPass> SSAA;
+    vtkSmartPointer<vtkToneMappingPass> ToneMapping;
+    vtkSmartPointer<vtkF3DSolidBackgroundPass> SolidBackground;
+    vtkSmartPointer<vtkOpenGLFXAAPass> FXAA;
+    vtkSmartPointer<vtkF3DUserRenderPass> User;
+    vtkSmartPointer<vtkF3DOverlayRenderPass> Overlay;
+  };
+
+  /**
+   * Create or update the chain of render passes in nodes.
+   * When interactive is true, create a cheaper chain used during interaction with progressive
+   * rendering: no ambient occlusion, background blur, grid reflection, SSAA nor TAA.
+   * Nodes still needed by the new chain are kept and reconfigured in place so that their
+   * framebuffers, textures and shader programs are not recreated, others are released.
+   */
+  void CreateRenderPasses(bool interactive, RenderPassNodes& nodes);
+
+  /**
+   * Release the graphics resources of all the nodes and clear them.
+   */
+  void ReleaseRenderPasses(RenderPassNodes& nodes);
+
   /**
    * Rotate camera and apply up direction to scene.
    * Called from UpdateActors when UpDirectionConfigured is false.
@@ -758,7 +822,25 @@ private:
   vtkNew<vtkSkybox> SkyboxActor;
   vtkNew<vtkF3DUIActor> UIActor;
 
-  unsigned int Timer = 0; // Timer OpenGL query
+  /**
+   * Timer OpenGL query of a frame, with the CPU time and the passes used to render it
+   */
+  struct FrameTimer
+  {
+    unsigned int Query = 0;
+    bool Pending = false;
+    bool FullQuality = true;
+    double CPUTime = 0.0;
+  };
+
+  /**
+   * Record the time of a rendered frame for the fps counter and for progressive rendering
+   */
+  void RecordFrameTime(double elapsedTime, bool fullQuality);
+
+  // Double-buffered so the query of the previous frame is read without waiting for the GPU
+  FrameTimer FrameTimers[2];
+  int CurrentFrameTimer = 0;
 
   bool CheatSheetConfigured = false;
   bool ActorsPropertiesConfigured = false;
@@ -804,6 +886,7 @@ private:
   BlendingMode BlendingModeEnabled = BlendingMode::NONE;
   bool UseSSAOPass = false;
   bool UseToneMappingPass = false;
+  bool UseProgressiveRendering = false;
   bool DisplayDepth = false;
   bool UseBlurBackground = false;
   std::optional<bool> UseOrthographicProjection = false;
@@ -826,12 +909,20 @@ private:
   double ColorAxisZ[3] = { 0.0, 0.0, 0.0 };
 
   std::string HDRIFile;
+  vtkSmartPointer<vtkF3DRenderPass> MainRenderPass;
+  vtkSmartPointer<vtkRenderPass> FullQualityPass;
+  vtkSmartPointer<vtkRenderPass> InteractivePass;
+  RenderPassNodes FullQualityNodes;
+  RenderPassNodes InteractiveNodes;
+  double FullQualityRenderTime = 0.0;
+
   vtkSmartPointer<vtkImageReader2> HDRIReader;
   bool HasValidHDRIReader = false;
   std::string HDRIHash;
   bool HasValidHDRIHash = false;
   vtkSmartPointer<vtkTexture> HDRITexture;
   bool HasValidHDRITexture = false;
+  bool HDRITextureReduced = false;
   bool HasValidHDRILUT = false;
   bool HasValidHDRISH = false;
   bool HasValidHDRISpec = false;
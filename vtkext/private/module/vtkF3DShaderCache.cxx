@@ -0,0 +1,350 @@
+#include "vtkF3DShaderCache.h"
+
+#include "F3DLog.h"
+
+#include <vtkObjectFactory.h>
+#include <vtkShader.h>
+#include <vtkShaderProgram.h>
+#include <vtk_glad.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/MD5.h>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+//----------------------------------------------------------------------------
+// vtkShaderProgram does not provide a way to use a program linked from a binary nor to set
+// parameters before its link. The protected vtkShaderProgram members are accessed through
+// pointers to members formed in a derived class, so that the program is in the same state as a
+// program compiled by VTK. A program loaded from a binary has no shader objects.
+struct vtkF3DShaderProgramState : public vtkShaderProgram
+{
+  static GLuint CreateHandle(vtkShaderProgram* program)
+  {
+    const GLuint handle = glCreateProgram();
+    program->*(&vtkF3DShaderProgramState::Handle) = static_cast<int>(handle);
+    program->*(&vtkF3DShaderProgramState::Linked) = false;
+    return handle;
+  }
+
+  static bool CompileAndAttach(vtkShaderProgram* program)
+  {
+    for (vtkShader* shader :
+      { program->GetVertexShader(), program->GetFragmentShader(), program->GetGeometryShader() })
+    {
+      // Like VTK, the geometry shader is optional
+      if (shader->GetSource().empty())
+      {
+        continue;
+      }
+      if (!shader->Compile() ||
+        !(program->*(&vtkF3DShaderProgramState::AttachShader))(shader))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static void Detach(vtkShaderProgram* program)
+  {
+    for (vtkShader* shader :
+      { program->GetVertexShader(), program->GetFragmentShader(), program->GetGeometryShader() })
+    {
+      if (shader->GetHandle() != 0)
+      {
+        (program->*(&vtkF3DShaderProgramState::DetachShader))(shader);
+      }
+    }
+  }
+
+  static bool LinkProgram(vtkShaderProgram* program)
+  {
+    if (!(program->*(&vtkF3DShaderProgramState::Link))())
+    {
+      return false;
+    }
+    program->*(&vtkF3DShaderProgramState::Compiled) = true;
+    return true;
+  }
+
+  static void SetLinked(vtkShaderProgram* program)
+  {
+    program->*(&vtkF3DShaderProgramState::Linked) = true;
+    program->*(&vtkF3DShaderProgramState::Compiled) = true;
+  }
+};
+
+//----------------------------------------------------------------------------
+std::string ComputeHash(const std::string& content)
+{
+  unsigned char digest[16];
+  char md5Hash[33];
+  md5Hash[32] = '\0';
+
+  vtksysMD5* md5 = vtksysMD5_New();
+  vtksysMD5_Initialize(md5);
+  vtksysMD5_Append(md5, reinterpret_cast<const unsigned char*>(content.data()),
+    static_cast<int>(content.size()));
+  vtksysMD5_Finalize(md5, digest);
+  vtksysMD5_DigestToHex(digest, md5Hash);
+  vtksysMD5_Delete(md5);
+
+  return md5Hash;
+}
+
+//----------------------------------------------------------------------------
+std::string GetGLString(GLenum name)
+{
+  const GLubyte* value = glGetString(name);
+  return value ? reinterpret_cast<const char*>(value) : "";
+}
+}
+
+vtkStandardNewMacro(vtkF3DShaderCache);
+
+//----------------------------------------------------------------------------
+void vtkF3DShaderCache::Install(vtkOpenGLShaderCache*& shaderCache)
+{
+  if (shaderCache)
+  {
+    shaderCache->Delete();
+  }
+  shaderCache = vtkF3DShaderCache::New();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DShaderCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CachePath: " << this->CachePath << "\n";
+  os << indent << "MaximumCacheSize: " << this->MaximumCacheSize << "\n";
+  os << indent << "NumberOfLoadedBinaries: " << this->NumberOfLoadedBinaries << "\n";
+  os << indent << "NumberOfSavedBinaries: " << this->NumberOfSavedBinaries << "\n";
+}
+
+//----------------------------------------------------------------------------
+vtkShaderProgram* vtkF3DShaderCache::ReadyShaderProgram(
+  vtkShaderProgram* shader, vtkTransformFeedback* cap)
+{
+  if (!shader || shader->GetCompiled() || cap || this->CachePath.empty() ||
+    !this->IsBinarySupported())
+  {
+    return this->Superclass::ReadyShaderProgram(shader, cap);
+  }
+
+  const std::string path = this->GetBinaryPath(shader);
+  if (this->LoadProgramBinary(shader, path))
+  {
+    // The program is linked, the superclass only binds it
+    return this->Superclass::ReadyShaderProgram(shader, cap);
+  }
+
+  if (this->CompileRetrievableProgram(shader))
+  {
+    this->SaveProgramBinary(shader, path);
+  }
+  else
+  {
+    // Let the superclass compile the program again and report the errors
+    ::vtkF3DShaderProgramState::Detach(shader);
+    shader->ReleaseGraphicsResources(nullptr);
+  }
+  return this->Superclass::ReadyShaderProgram(shader, cap);
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DShaderCache::IsBinarySupported()
+{
+  if (!this->BinarySupported.has_value())
+  {
+    // GL_NUM_PROGRAM_BINARY_FORMATS is unknown to drivers without program binary support,
+    // the value is left untouched and the resulting error is discarded
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+
+    this->BinarySupported = formats > 0;
+    this->DriverKey =
+      ::GetGLString(GL_VENDOR) + ::GetGLString(GL_RENDERER) + ::GetGLString(GL_VERSION);
+
+    if (!this->BinarySupported.value())
+    {
+      F3DLog::Print(F3DLog::Severity::Debug,
+        "Shader program binaries are not supported by the driver, binary cache disabled");
+    }
+  }
+  return this->BinarySupported.value();
+}
+
+//----------------------------------------------------------------------------
+std::string vtkF3DShaderCache::GetBinaryPath(vtkShaderProgram* shader)
+{
+  std::string key = this->DriverKey;
+  key += shader->GetVertexShader()->GetSource();
+  key += shader->GetFragmentShader()->GetSource();
+  key += shader->GetGeometryShader()->GetSource();
+  return this->CachePath + "/" + ::ComputeHash(key) + ".bin";
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DShaderCache::LoadProgramBinary(vtkShaderProgram* shader, const std::string& path)
+{
+  vtksys::ifstream file(path.c_str(), std::ios_base::binary);
+  if (!file.is_open())
+  {
+    return false;
+  }
+
+  GLenum format = 0;
+  file.read(reinterpret_cast<char*>(&format), sizeof(format));
+  const std::vector<char> binary(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (binary.empty())
+  {
+    return false;
+  }
+
+  // The binary replaces the compilation and the link, no shader object is created
+  const GLuint handle = ::vtkF3DShaderProgramState::CreateHandle(shader);
+  glProgramBinary(handle, format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+  GLint status = GL_FALSE;
+  glGetProgramiv(handle, GL_LINK_STATUS, &status);
+  if (status != GL_TRUE)
+  {
+    // The driver changed or rejected the binary, the program will be compiled again
+    // and its binary will replace this one
+    F3DLog::Print(F3DLog::Severity::Debug, "Shader program binary rejected: " + path);
+    shader->ReleaseGraphicsResources(nullptr);
+    return false;
+  }
+
+  ::vtkF3DShaderProgramState::SetLinked(shader);
+  this->NumberOfLoadedBinaries++;
+
+  // Mark the binary as recently used so that it is the last one to be evicted
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DShaderCache::CompileRetrievableProgram(vtkShaderProgram* shader)
+{
+  if (!::vtkF3DShaderProgramState::CompileAndAttach(shader))
+  {
+    return false;
+  }
+
+  // Drivers may only keep a retrievable binary if requested before linking
+  glProgramParameteri(static_cast<GLuint>(shader->GetHandle()),
+    GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  return ::vtkF3DShaderProgramState::LinkProgram(shader);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DShaderCache::SaveProgramBinary(vtkShaderProgram* shader, const std::string& path)
+{
+  const GLuint handle = static_cast<GLuint>(shader->GetHandle());
+
+  GLint length = 0;
+  glGetProgramiv(handle, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+  {
+    return;
+  }
+
+  std::vector<char> binary(length);
+  GLsizei written = 0;
+  GLenum format = 0;
+  glGetProgramBinary(handle, length, &written, &format, binary.data());
+  if (written <= 0)
+  {
+    return;
+  }
+
+  if (!vtksys::SystemTools::MakeDirectory(this->CachePath))
+  {
+    return;
+  }
+
+  // Write into a temporary file first so that concurrent processes never read a partial binary
+  const std::string tmpPath = path + ".tmp";
+  {
+    vtksys::ofstream file(tmpPath.c_str(), std::ios_base::binary);
+    if (!file.is_open())
+    {
+      return;
+    }
+    file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+    file.write(binary.data(), written);
+  }
+  if (vtksys::SystemTools::RenameFile(tmpPath, path))
+  {
+    this->NumberOfSavedBinaries++;
+    this->EvictBinaries();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DShaderCache::EvictBinaries()
+{
+  struct Binary
+  {
+    fs::path Path;
+    fs::file_time_type Time;
+    uintmax_t Size;
+  };
+
+  // The cache is shared between processes, errors are expected if another process
+  // evicts the same binaries and are ignored
+  std::error_code ec;
+  std::vector<Binary> binaries;
+  uintmax_t totalSize = 0;
+  for (const fs::directory_entry& entry : fs::directory_iterator(this->CachePath, ec))
+  {
+    if (entry.path().extension() != ".bin")
+    {
+      continue;
+    }
+    const uintmax_t size = entry.file_size(ec);
+    const fs::file_time_type time = entry.last_write_time(ec);
+    if (!ec)
+    {
+      binaries.push_back({ entry.path(), time, size });
+      totalSize += size;
+    }
+    ec.clear();
+  }
+
+  if (totalSize <= this->MaximumCacheSize)
+  {
+    return;
+  }
+
+  // Remove the least recently used binaries first
+  std::sort(binaries.begin(), binaries.end(),
+    [](const Binary& a, const Binary& b) { return a.Time < b.Time; });
+  for (const Binary& binary : binaries)
+  {
+    if (totalSize <= this->MaximumCacheSize)
+    {
+      break;
+    }
+    if (fs::remove(binary.Path, ec))
+    {
+      totalSize -= binary.Size;
+    }
+  }
+}
@@ -0,0 +1,125 @@
+/**
+ * @class   vtkF3DShaderCache
+ * @brief   A shader cache storing linked program binaries on disk
+ *
+ * This shader cache saves the binary of every linked shader program into a cache directory
+ * and loads it back instead of compiling and linking the sources on later runs.
+ * Binaries are keyed on the shader sources and the OpenGL vendor, renderer and version strings.
+ * When the driver rejects a binary, eg: after a driver update, the program is compiled from
+ * the sources and its binary is written again.
+ * The cache directory is bounded in size, the least recently used binaries are evicted first.
+ * Program binaries are only used if the driver supports at least one binary format.
+ *
+ * vtkOpenGLShaderCache is not created through the object factory, the F3D render windows
+ * install this cache from their constructor using Install.
+ */
+
+#ifndef vtkF3DShaderCache_h
+#define vtkF3DShaderCache_h
+
+#include <vtkOpenGLShaderCache.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+class vtkF3DShaderCache : public vtkOpenGLShaderCache
+{
+public:
+  static vtkF3DShaderCache* New();
+  vtkTypeMacro(vtkF3DShaderCache, vtkOpenGLShaderCache);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Replace the provided shader cache of a render window by a new vtkF3DShaderCache.
+   * To be called from the constructor of a vtkOpenGLRenderWindow subclass.
+   */
+  static void Install(vtkOpenGLShaderCache*& shaderCache);
+
+  ///@{
+  /**
+   * Set/Get the directory where program binaries are stored.
+   * An empty path disables the binary cache.
+   * Default is empty.
+   */
+  vtkSetMacro(CachePath, std::string);
+  vtkGetMacro(CachePath, std::string);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum size in bytes of the binaries stored in the cache directory.
+   * When a new binary makes the cache exceed this size, the least recently used binaries
+   * are removed.
+   * Default is 64 MiB.
+   */
+  vtkSetMacro(MaximumCacheSize, uintmax_t);
+  vtkGetMacro(MaximumCacheSize, uintmax_t);
+  ///@}
+
+  ///@{
+  /**
+   * Get the number of programs created from a cached binary and the number of binaries
+   * written to the cache by this instance.
+   */
+  vtkGetMacro(NumberOfLoadedBinaries, int);
+  vtkGetMacro(NumberOfSavedBinaries, int);
+  ///@}
+
+  /**
+   * Load the program binary from the cache if available, otherwise compile the program and
+   * store its binary in the cache. Programs with transform feedback are never cached.
+   */
+  using Superclass::ReadyShaderProgram;
+  vtkShaderProgram* ReadyShaderProgram(
+    vtkShaderProgram* shader, vtkTransformFeedback* cap = nullptr) override;
+
+protected:
+  vtkF3DShaderCache() = default;
+  ~vtkF3DShaderCache() override = default;
+
+private:
+  vtkF3DShaderCache(const vtkF3DShaderCache&) = delete;
+  void operator=(const vtkF3DShaderCache&) = delete;
+
+  /**
+   * Check that program binaries are supported by the current context and
+   * initialize the driver part of the key, only done once.
+   */
+  bool IsBinarySupported();
+
+  /**
+   * Return the path of the binary file of the provided program.
+   */
+  std::string GetBinaryPath(vtkShaderProgram* shader);
+
+  /**
+   * Create the program from a binary file without compiling it, returns false if the file is
+   * missing or if the driver rejects the binary.
+   */
+  bool LoadProgramBinary(vtkShaderProgram* shader, const std::string& path);
+
+  /**
+   * Compile and link the program with the binary retrievable hint, returns false on failure.
+   */
+  bool CompileRetrievableProgram(vtkShaderProgram* shader);
+
+  /**
+   * Write the binary of a linked program to a file.
+   */
+  void SaveProgramBinary(vtkShaderProgram* shader, const std::string& path);
+
+  /**
+   * Remove the least recently used binaries until the cache fits in MaximumCacheSize.
+   */
+  void EvictBinaries();
+
+  std::string CachePath;
+  uintmax_t MaximumCacheSize = 64 * 1024 * 1024;
+  std::optional<bool> BinarySupported;
+  std::string DriverKey;
+  int NumberOfLoadedBinaries = 0;
+  int NumberOfSavedBinaries = 0;
+};
+
+#endif
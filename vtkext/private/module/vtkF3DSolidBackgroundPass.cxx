@@ -1,5 +1,6 @@
 #include "vtkF3DSolidBackgroundPass.h"
 
+#include "vtkF3DRenderTargetPool.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLError.h"
 #include "vtkOpenGLFramebufferObject.h"
@@ -37,17 +38,9 @@ void vtkF3DSolidBackgroundPass::Render(const vtkRenderState* state)
   int size[2];
   ren->GetTiledSizeAndOrigin(&size[0], &size[1], &pos[0], &pos[1]);
 
-  if (this->ColorTexture == nullptr)
-  {
-    this->ColorTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->ColorTexture->SetContext(renWin);
-    this->ColorTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->Allocate2D(size[0], size[1], 4, VTK_UNSIGNED_CHAR);
-  }
-  this->ColorTexture->Resize(size[0], size[1]);
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(ren);
+  this->ColorTexture =
+    pool->Acquire(renWin, size[0], size[1], vtkF3DRenderTargetPool::Format::RGBA8);
 
   if (this->FrameBufferObject == nullptr)
   {
@@ -98,6 +91,8 @@ void vtkF3DSolidBackgroundPass::Render(const vtkRenderState* state)
   this->QuadHelper->Render();
 
   this->ColorTexture->Deactivate();
+  pool->Release(this->ColorTexture);
+  this->ColorTexture = nullptr;
 
   vtkOpenGLCheckErrorMacro("failed after Render");
 }
@@ -111,8 +106,4 @@ void vtkF3DSolidBackgroundPass::ReleaseGraphicsResources(vtkWindow* win)
   {
     this->FrameBufferObject->ReleaseGraphicsResources(win);
   }
-  if (this->ColorTexture)
-  {
-    this->ColorTexture->ReleaseGraphicsResources(win);
-  }
 }
@@ -1,5 +1,7 @@
 #include "vtkF3DTAAPass.h"
 
+#include "vtkF3DRenderTargetPool.h"
+
 #include <vtkCamera.h>
 #include <vtkObjectFactory.h>
 #include <vtkOpenGLError.h>
@@ -54,20 +56,11 @@ void vtkF3DTAAPass::Render(const vtkRenderState* state)
   }
   this->HistoryTexture->Resize(size[0], size[1]);
 
-  if (this->ColorTexture == nullptr)
-  {
-    this->ColorTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->ColorTexture->SetContext(renWin);
-    this->ColorTexture->SetFormat(GL_RGBA);
-    this->ColorTexture->SetInternalFormat(GL_RGBA32F);
-    this->ColorTexture->SetDataType(GL_FLOAT);
-    this->ColorTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->Allocate2D(size[0], size[1], 4, VTK_FLOAT);
-  }
-  this->ColorTexture->Resize(size[0], size[1]);
+  // The current frame is only needed until it is blended with the history, half float is enough
+  // for it, the history keeps full precision since it accumulates up to 1024 frames
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(renderer);
+  this->ColorTexture =
+    pool->Acquire(renWin, size[0], size[1], vtkF3DRenderTargetPool::Format::RGBA16F);
 
   if (this->FrameBufferObject == nullptr)
   {
@@ -125,6 +118,8 @@ void vtkF3DTAAPass::Render(const vtkRenderState* state)
 
   this->ColorTexture->Deactivate();
   this->HistoryTexture->Deactivate();
+  pool->Release(this->ColorTexture);
+  this->ColorTexture = nullptr;
   this->HistoryTexture->CopyFromFrameBuffer(pos[0], pos[1], size[0], size[1], size[0], size[1]);
   this->HistoryIteration = std::min(this->HistoryIteration + 1, 1024);
 
@@ -140,10 +135,6 @@ void vtkF3DTAAPass::ReleaseGraphicsResources(vtkWindow* window)
   {
     this->FrameBufferObject->ReleaseGraphicsResources(window);
   }
-  if (this->ColorTexture)
-  {
-    this->ColorTexture->ReleaseGraphicsResources(window);
-  }
   if (this->HistoryTexture)
   {
     this->HistoryTexture->ReleaseGraphicsResources(window);
@@ -44,6 +44,15 @@ public:
     this->HistoryIteration = 0;
   }
 
+  /**
+   * Return true once enough frames have been accumulated in the history
+   * for an additional frame to not bring any visible improvement.
+   */
+  bool IsConverged() const
+  {
+    return this->HistoryIteration >= vtkF3DTAAPass::ConvergedIteration;
+  }
+
   /**
    * Modify shader code for jittering
    */
@@ -77,6 +86,8 @@ private:
 
   std::shared_ptr<vtkOpenGLQuadHelper> QuadHelper;
 
+  static constexpr int ConvergedIteration = 64;
+
   int HistoryIteration = 0;
   float Jitter[2] = { 0.0f, 0.0f };
   int TaaHaltonNumerator[2] = { 0, 0 };
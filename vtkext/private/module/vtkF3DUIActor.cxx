@@ -183,6 +183,13 @@ void vtkF3DUIActor::UpdateFpsValue(const double elapsedFrameTime)
   this->FpsValue = static_cast<int>(std::round(1.0 / averageFrameTime));
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DUIActor::SetCullingStatistics(int culledProps, int totalProps)
+{
+  this->CulledProps = culledProps;
+  this->TotalProps = totalProps;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::SetFontFile(const std::string& font)
 {
@@ -328,6 +335,14 @@ int vtkF3DUIActor::RenderOverlay(vtkViewport* vp)
   return 1;
 }
 
+//----------------------------------------------------------------------------
+bool vtkF3DUIActor::IsAnimated() const
+{
+  // Keep refreshing the fps counter while idle, as it was before renders were skipped
+  return (this->NotificationVisible && !this->Notifications.empty()) || this->ConsoleVisible ||
+    this->MinimalConsoleVisible || this->FpsCounterVisible;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::AddNotification(const std::string& desc, const std::string& value,
   const std::string& bind, double startTime, double duration)
@@ -189,6 +189,13 @@ public:
    */
   void UpdateFpsValue(const double elapsedFrameTime);
 
+  /**
+   * Set the number of props culled during the last frame and the total number of props,
+   * displayed with the fps counter when some props were culled
+   * 0 by default
+   */
+  void SetCullingStatistics(int culledProps, int totalProps);
+
   /**
    * Set the font file path
    * Use Inter font by default if empty
@@ -228,6 +235,13 @@ public:
   {
   }
 
+  /**
+   * Return true if the UI changes over time and should be rendered again even when nothing
+   * else changed, which is the case while notifications are displayed, the console is visible or
+   * the fps counter is visible.
+   */
+  bool IsAnimated() const;
+
   /**
    * Add notification info to deque
    */
@@ -404,6 +418,8 @@ protected:
 
   double TotalFrameTimes = 0.0;
   int FpsValue = 0;
+  int CulledProps = 0;
+  int TotalProps = 0;
 
   std::string FontFile = "";
   double FontScale = 1.0;
@@ -1,6 +1,7 @@
 #include "vtkF3DUserRenderPass.h"
 
 #include "vtkF3DRenderer.h"
+#include "vtkF3DRenderTargetPool.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLError.h"
 #include "vtkOpenGLFramebufferObject.h"
@@ -38,17 +39,9 @@ void vtkF3DUserRenderPass::Render(const vtkRenderState* s)
   int size[2];
   r->GetTiledSizeAndOrigin(&size[0], &size[1], &pos[0], &pos[1]);
 
-  if (this->ColorTexture == nullptr)
-  {
-    this->ColorTexture = vtkSmartPointer<vtkTextureObject>::New();
-    this->ColorTexture->SetContext(renWin);
-    this->ColorTexture->SetMinificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetMagnificationFilter(vtkTextureObject::Linear);
-    this->ColorTexture->SetWrapS(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->SetWrapT(vtkTextureObject::ClampToEdge);
-    this->ColorTexture->Allocate2D(size[0], size[1], 4, VTK_UNSIGNED_CHAR);
-  }
-  this->ColorTexture->Resize(size[0], size[1]);
+  vtkF3DRenderTargetPool* pool = vtkF3DRenderTargetPool::GetPool(r);
+  this->ColorTexture =
+    pool->Acquire(renWin, size[0], size[1], vtkF3DRenderTargetPool::Format::RGBA8);
 
   if (this->FrameBufferObject == nullptr)
   {
@@ -93,6 +86,8 @@ void vtkF3DUserRenderPass::Render(const vtkRenderState* s)
   if (!this->QuadHelper->Program || !this->QuadHelper->Program->GetCompiled())
   {
     vtkErrorMacro("Couldn't build the shader program.");
+    pool->Release(this->ColorTexture);
+    this->ColorTexture = nullptr;
     return;
   }
 
@@ -118,6 +113,8 @@ void vtkF3DUserRenderPass::Render(const vtkRenderState* s)
   this->QuadHelper->Render();
 
   this->ColorTexture->Deactivate();
+  pool->Release(this->ColorTexture);
+  this->ColorTexture = nullptr;
 
   vtkOpenGLCheckErrorMacro("failed after Render");
 }
@@ -131,8 +128,4 @@ void vtkF3DUserRenderPass::ReleaseGraphicsResources(vtkWindow* w)
   {
     this->FrameBufferObject->ReleaseGraphicsResources(w);
   }
-  if (this->ColorTexture)
-  {
-    this->ColorTexture->ReleaseGraphicsResources(w);
-  }
 }
@@ -1,6 +1,7 @@
 #include <vtkObjectFactory.h>
 
 #include "vtkF3DWGLRenderWindow.h"
+#include "vtkF3DShaderCache.h"
 
 #include <Windows.h>
 #include <dwmapi.h>
@@ -83,7 +84,10 @@ bool IsWindowsInDarkMode()
 vtkStandardNewMacro(vtkF3DWGLRenderWindow);
 
 //------------------------------------------------------------------------------
-vtkF3DWGLRenderWindow::vtkF3DWGLRenderWindow() = default;
+vtkF3DWGLRenderWindow::vtkF3DWGLRenderWindow()
+{
+  vtkF3DShaderCache::Install(this->ShaderCache);
+}
 
 //------------------------------------------------------------------------------
 vtkF3DWGLRenderWindow::~vtkF3DWGLRenderWindow() = default;
@@ -8,6 +8,7 @@
 #endif
 
 #include <charconv>
+#include <sstream>
 #include <stdexcept>
 
 //----------------------------------------------------------------------------
@@ -57,3 +58,21 @@ int F3DUtils::ParseToInt(const std::string& str, int def, const std::string& nam
   }
   return value;
 }
+
+//----------------------------------------------------------------------------
+std::vector<std::string> F3DUtils::ParseToStrings(const std::string& str)
+{
+  std::vector<std::string> values;
+  std::istringstream stream(str);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    const size_t first = item.find_first_not_of(" \t");
+    if (first != std::string::npos)
+    {
+      const size_t last = item.find_last_not_of(" \t");
+      values.emplace_back(item.substr(first, last - first + 1));
+    }
+  }
+  return values;
+}
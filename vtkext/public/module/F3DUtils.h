@@ -12,6 +12,7 @@
 
 /// @cond
 #include <string>
+#include <vector>
 /// @endcond
 
 namespace F3DUtils
@@ -30,6 +31,12 @@ VTKEXT_EXPORT double ParseToDouble(
  * Use nameError in the log for easier debugging.
  */
 VTKEXT_EXPORT int ParseToInt(const std::string& str, int def, const std::string& nameError);
+
+/*
+ * Split provided comma separated str into a list of strings and returns it.
+ * Surrounding whitespaces and empty items are removed.
+ */
+VTKEXT_EXPORT std::vector<std::string> ParseToStrings(const std::string& str);
 };
 
 #endif
@@ -0,0 +1,73 @@
+#include <vtkNew.h>
+#include <vtkVersion.h>
+
+#include "vtkF3DMappedFileResourceStream.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+int TestF3DMappedFileResourceStream(int vtkNotUsed(argc), char* argv[])
+{
+  vtkNew<vtkF3DMappedFileResourceStream> stream;
+  if (stream->Open(nullptr) || stream->Open("dummy.file"))
+  {
+    std::cerr << "Opening an invalid file should fail" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::string fileName = std::string(argv[1]) + "data/small.splat";
+  std::ifstream file(fileName, std::ios::binary);
+  std::vector<char> expected(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (expected.size() < 8)
+  {
+    std::cerr << "Unable to read " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!stream->Open(fileName.c_str()) || !stream->SupportSeek() ||
+    stream->Seek(0, vtkResourceStream::SeekDirection::End) !=
+      static_cast<vtkTypeInt64>(expected.size()))
+  {
+    std::cerr << "Unexpected mapping of " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  if (std::memcmp(stream->GetBuffer(), expected.data(), expected.size()) != 0)
+  {
+    std::cerr << "Unexpected mapped content" << std::endl;
+    return EXIT_FAILURE;
+  }
+#endif
+
+  std::vector<char> content(expected.size());
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+  if (stream->Read(content.data(), content.size()) != content.size() || content != expected)
+  {
+    std::cerr << "Unexpected read content" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  char tail[4];
+  stream->Seek(-4, vtkResourceStream::SeekDirection::End);
+  if (stream->Read(tail, 4) != 4 || std::memcmp(tail, expected.data() + expected.size() - 4, 4))
+  {
+    std::cerr << "Unexpected content after seeking" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // An empty file is a valid empty stream
+  if (!stream->Open((std::string(argv[1]) + "data/empty.splat").c_str()) ||
+    stream->Read(tail, 4) != 0 || !stream->EndOfStream())
+  {
+    std::cerr << "Unexpected mapping of an empty file" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+#include <vtkActor.h>
+#include <vtkFloatArray.h>
+#include <vtkInformation.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+
+#include "vtkF3DVertexAnimation.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkFloatArray> CreateArray(const float (&values)[2][3])
+{
+  vtkNew<vtkFloatArray> array;
+  array->SetNumberOfComponents(3);
+  array->SetNumberOfTuples(2);
+  array->SetTypedTuple(0, values[0]);
+  array->SetTypedTuple(1, values[1]);
+  return array;
+}
+
+// Positions are quantized on 16 bits and normals on 8 bits per coordinate
+bool CheckTuple(
+  vtkDataArray* array, vtkIdType index, double x, double y, double z, double tolerance = 1e-3)
+{
+  double tuple[3];
+  array->GetTuple(index, tuple);
+  return std::abs(tuple[0] - x) < tolerance && std::abs(tuple[1] - y) < tolerance &&
+    std::abs(tuple[2] - z) < tolerance;
+}
+}
+
+int TestF3DVertexAnimation(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  vtkNew<vtkPoints> points;
+  points->SetData(::CreateArray({ { 0, 0, 0 }, { 1, 0, 0 } }));
+  vtkNew<vtkPolyData> mesh;
+  mesh->SetPoints(points);
+  mesh->GetPointData()->SetNormals(::CreateArray({ { 0, 0, 1 }, { 0, 0, 1 } }));
+
+  vtkNew<vtkF3DVertexAnimation> animation;
+  if (animation->AddKeyframe(::CreateArray({ { 0, 0, 0 }, { 0, 0, 0 } })) != -1)
+  {
+    std::cerr << "Adding a keyframe without a mesh should fail" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  animation->SetMesh(mesh);
+  if (vtkF3DVertexAnimation::GetVertexAnimation(mesh) != animation ||
+    animation->GetMesh() != mesh)
+  {
+    std::cerr << "The animation is not stored in the mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (animation->AddKeyframe(::CreateArray({ { 2, 0, 0 }, { 3, 0, 0 } }),
+        ::CreateArray({ { 1, 0, 0 }, { 1, 0, 0 } })) != 1 ||
+    animation->AddKeyframe(::CreateArray({ { 0, 4, 0 }, { 1, 4, 0 } })) != 2 ||
+    animation->GetNumberOfKeyframes() != 3)
+  {
+    std::cerr << "Unexpected keyframes" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Keyframes are not stored in the point data, 8 bytes per point per keyframe
+  if (mesh->GetPointData()->GetNumberOfArrays() != 1 ||
+    animation->GetEncodedKeyframes().size() != 4 * 2 * 3 ||
+    animation->GetKeyframeBounds().size() != 8 * 3)
+  {
+    std::cerr << "Unexpected keyframes storage" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkFloatArray> invalid;
+  invalid->SetNumberOfComponents(3);
+  invalid->SetNumberOfTuples(1);
+  if (animation->AddKeyframe(invalid) != -1)
+  {
+    std::cerr << "Adding a keyframe not matching the mesh should fail" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkActor> actor;
+  animation->InterpolateKeyframes(actor, 1, 2, 0.25);
+  vtkSmartPointer<vtkPolyData> displayed = vtkF3DVertexAnimation::GetAnimatedMesh(actor, mesh);
+  if (!::CheckTuple(displayed->GetPoints()->GetData(), 0, 1.5, 1, 0) ||
+    !::CheckTuple(displayed->GetPoints()->GetData(), 1, 2.5, 1, 0))
+  {
+    std::cerr << "Unexpected interpolated positions" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  animation->InterpolateKeyframes(actor, 0, 1, 0.5);
+  displayed = vtkF3DVertexAnimation::GetAnimatedMesh(actor, mesh);
+  const double half = std::sqrt(0.5);
+  if (!::CheckTuple(displayed->GetPoints()->GetData(), 1, 2, 0, 0) ||
+    !::CheckTuple(displayed->GetPointData()->GetNormals(), 0, half, 0, half, 1e-2))
+  {
+    std::cerr << "Unexpected interpolated positions or normals" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  animation->InterpolateKeyframes(actor, 0, 0, 0.0);
+  displayed = vtkF3DVertexAnimation::GetAnimatedMesh(actor, mesh);
+  if (!::CheckTuple(displayed->GetPoints()->GetData(), 1, 1, 0, 0) ||
+    !::CheckTuple(displayed->GetPointData()->GetNormals(), 1, 0, 0, 1, 1e-2))
+  {
+    std::cerr << "Unexpected first keyframe" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Animating another mesh removes the animation from the previous one
+  vtkNew<vtkPolyData> other;
+  other->DeepCopy(mesh);
+  animation->SetMesh(other);
+  if (vtkF3DVertexAnimation::GetVertexAnimation(mesh) ||
+    vtkF3DVertexAnimation::GetVertexAnimation(other) != animation ||
+    animation->GetNumberOfKeyframes() != 1)
+  {
+    std::cerr << "Unexpected animated mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+#include "vtkF3DMappedFileResourceStream.h"
+
+#include <vtkObjectFactory.h>
+
+#ifdef _WIN32
+#include <vtksys/Encoding.hxx>
+
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkF3DMappedFileResourceStream);
+
+//----------------------------------------------------------------------------
+vtkF3DMappedFileResourceStream::~vtkF3DMappedFileResourceStream()
+{
+  this->Close();
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DMappedFileResourceStream::Open(const char* fileName)
+{
+  this->Close();
+  if (!fileName)
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(vtksys::Encoding::ToWindowsExtendedPath(fileName).c_str(),
+    GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  // A mapping cannot be created for an empty file
+  if (size.QuadPart > 0)
+  {
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping)
+    {
+      this->Mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(mapping);
+    }
+    if (!this->Mapping)
+    {
+      CloseHandle(file);
+      return false;
+    }
+    this->MappingSize = static_cast<std::size_t>(size.QuadPart);
+  }
+  CloseHandle(file);
+#else
+  int file = open(fileName, O_RDONLY);
+  if (file < 0)
+  {
+    return false;
+  }
+
+  struct stat status;
+  if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode))
+  {
+    close(file);
+    return false;
+  }
+
+  // A mapping cannot be created for an empty file
+  if (status.st_size > 0)
+  {
+    void* mapping =
+      mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    if (mapping == MAP_FAILED)
+    {
+      close(file);
+      return false;
+    }
+    this->Mapping = mapping;
+    this->MappingSize = static_cast<std::size_t>(status.st_size);
+  }
+  close(file);
+#endif
+
+  // The mapping stays valid after closing the file, until it is released
+  this->SetBuffer(this->Mapping, this->MappingSize, false);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMappedFileResourceStream::Close()
+{
+  // Do not let the buffer point to released memory
+  this->SetBuffer(nullptr, 0, false);
+
+  if (this->Mapping)
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(this->Mapping);
+#else
+    munmap(this->Mapping, this->MappingSize);
+#endif
+  }
+  this->Mapping = nullptr;
+  this->MappingSize = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DMappedFileResourceStream::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MappingSize: " << this->MappingSize << "\n";
+}
@@ -0,0 +1,48 @@
+/**
+ * @class   vtkF3DMappedFileResourceStream
+ * @brief   Resource stream of a memory-mapped local file
+ *
+ * This stream maps a local file in memory instead of reading it through a file handle.
+ * As it is a vtkMemoryResourceStream, readers that already handle memory streams, by parsing the
+ * buffer directly, can read a local file opened with this class without copying it.
+ * The mapping is released when the stream is destroyed or when another file is opened.
+ */
+
+#ifndef vtkF3DMappedFileResourceStream_h
+#define vtkF3DMappedFileResourceStream_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <vtkMemoryResourceStream.h>
+/// @endcond
+
+class VTKEXT_EXPORT vtkF3DMappedFileResourceStream : public vtkMemoryResourceStream
+{
+public:
+  static vtkF3DMappedFileResourceStream* New();
+  vtkTypeMacro(vtkF3DMappedFileResourceStream, vtkMemoryResourceStream);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Map the file in memory, releasing the previously mapped file if any.
+   * An empty file is opened as an empty buffer.
+   * Return true on success, false otherwise, in which case the stream is empty.
+   */
+  bool Open(const char* fileName);
+
+protected:
+  vtkF3DMappedFileResourceStream() = default;
+  ~vtkF3DMappedFileResourceStream() override;
+
+private:
+  vtkF3DMappedFileResourceStream(const vtkF3DMappedFileResourceStream&) = delete;
+  void operator=(const vtkF3DMappedFileResourceStream&) = delete;
+
+  void Close();
+
+  void* Mapping = nullptr;
+  std::size_t MappingSize = 0;
+};
+
+#endif
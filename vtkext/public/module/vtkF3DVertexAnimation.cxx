@@ -0,0 +1,368 @@
+#include "vtkF3DVertexAnimation.h"
+
+#include <vtkActor.h>
+#include <vtkDataArray.h>
+#include <vtkFloatArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationObjectBaseKey.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkShaderProperty.h>
+#include <vtkUniforms.h>
+#include <vtkWeakPointer.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace
+{
+// Largest quantized value, positions and normals being stored on 16 bits
+constexpr double QuantizationMax = 65535.0;
+
+//----------------------------------------------------------------------------
+// Octahedral encoding of a unit vector, each coordinate on 8 bits, see vtkF3DRenderPass
+unsigned short EncodeNormal(const double normal[3])
+{
+  const double l1 = std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]);
+  double x = l1 > 0.0 ? normal[0] / l1 : 0.0;
+  double y = l1 > 0.0 ? normal[1] / l1 : 0.0;
+  if (l1 > 0.0 && normal[2] < 0.0)
+  {
+    const double foldedX = (1.0 - std::abs(y)) * (x >= 0.0 ? 1.0 : -1.0);
+    const double foldedY = (1.0 - std::abs(x)) * (y >= 0.0 ? 1.0 : -1.0);
+    x = foldedX;
+    y = foldedY;
+  }
+
+  auto quantize = [](double value)
+  { return static_cast<unsigned int>(std::lround((std::clamp(value, -1.0, 1.0) + 1.0) * 127.5)); };
+  return static_cast<unsigned short>((quantize(x) << 8) | quantize(y));
+}
+
+//----------------------------------------------------------------------------
+void DecodeNormal(unsigned short packed, double normal[3])
+{
+  double x = (packed >> 8) / 127.5 - 1.0;
+  double y = (packed & 255) / 127.5 - 1.0;
+  const double z = 1.0 - std::abs(x) - std::abs(y);
+  if (z < 0.0)
+  {
+    const double unfoldedX = (1.0 - std::abs(y)) * (x >= 0.0 ? 1.0 : -1.0);
+    const double unfoldedY = (1.0 - std::abs(x)) * (y >= 0.0 ? 1.0 : -1.0);
+    x = unfoldedX;
+    y = unfoldedY;
+  }
+  const double norm = std::hypot(x, y, z);
+  normal[0] = x / norm;
+  normal[1] = y / norm;
+  normal[2] = z / norm;
+}
+}
+
+//----------------------------------------------------------------------------
+class vtkF3DVertexAnimation::vtkInternals
+{
+public:
+  //----------------------------------------------------------------------------
+  // Quantize the positions in their bounding box and encode the normals
+  void Encode(vtkDataArray* positions, vtkDataArray* normals)
+  {
+    std::array<double, 3> origin;
+    std::array<double, 3> size;
+    for (int comp = 0; comp < 3; comp++)
+    {
+      double range[2];
+      positions->GetRange(range, comp);
+      origin[comp] = range[0];
+      size[comp] = range[1] - range[0];
+    }
+    this->Bounds.insert(this->Bounds.end(),
+      { static_cast<float>(origin[0]), static_cast<float>(origin[1]),
+        static_cast<float>(origin[2]), 0.f, static_cast<float>(size[0]),
+        static_cast<float>(size[1]), static_cast<float>(size[2]), 0.f });
+
+    const size_t start = this->Encoded.size();
+    this->Encoded.resize(start + 4 * this->NumberOfPoints, 0);
+    unsigned short* encoded = this->Encoded.data() + start;
+    vtkSMPTools::For(0, this->NumberOfPoints,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          for (int comp = 0; comp < 3; comp++)
+          {
+            const double value = size[comp] > 0.0
+              ? (positions->GetComponent(i, comp) - origin[comp]) / size[comp]
+              : 0.0;
+            encoded[4 * i + comp] = static_cast<unsigned short>(
+              std::lround(std::clamp(value, 0.0, 1.0) * ::QuantizationMax));
+          }
+          if (normals)
+          {
+            double normal[3];
+            normals->GetTuple(i, normal);
+            encoded[4 * i + 3] = ::EncodeNormal(normal);
+          }
+        }
+      });
+    this->NumberOfKeyframes++;
+  }
+
+  //----------------------------------------------------------------------------
+  // Decode and interpolate two keyframes in the points and normals of the output
+  void Interpolate(int first, int second, double factor, vtkPolyData* output) const
+  {
+    vtkNew<vtkFloatArray> positions;
+    positions->SetNumberOfComponents(3);
+    positions->SetNumberOfTuples(this->NumberOfPoints);
+
+    vtkSmartPointer<vtkFloatArray> normals;
+    if (this->HasNormals)
+    {
+      normals = vtkSmartPointer<vtkFloatArray>::New();
+      normals->SetName(output->GetPointData()->GetNormals()
+          ? output->GetPointData()->GetNormals()->GetName()
+          : "Normals");
+      normals->SetNumberOfComponents(3);
+      normals->SetNumberOfTuples(this->NumberOfPoints);
+    }
+
+    const std::array<int, 2> keyframes = { first, second };
+    const std::array<double, 2> weights = { 1.0 - factor, factor };
+    vtkSMPTools::For(0, this->NumberOfPoints,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          double position[3] = { 0.0, 0.0, 0.0 };
+          double normal[3] = { 0.0, 0.0, 0.0 };
+          for (int k = 0; k < 2; k++)
+          {
+            const unsigned short* encoded =
+              this->Encoded.data() + 4 * (keyframes[k] * this->NumberOfPoints + i);
+            const float* bounds = this->Bounds.data() + 8 * keyframes[k];
+            double decodedNormal[3];
+            ::DecodeNormal(encoded[3], decodedNormal);
+            for (int comp = 0; comp < 3; comp++)
+            {
+              position[comp] += weights[k] *
+                (bounds[comp] + bounds[4 + comp] * encoded[comp] / ::QuantizationMax);
+              normal[comp] += weights[k] * decodedNormal[comp];
+            }
+          }
+          const double norm = std::hypot(normal[0], normal[1], normal[2]);
+          for (int comp = 0; comp < 3; comp++)
+          {
+            positions->SetTypedComponent(i, comp, static_cast<float>(position[comp]));
+            if (normals)
+            {
+              normals->SetTypedComponent(
+                i, comp, static_cast<float>(norm > 0.0 ? normal[comp] / norm : normal[comp]));
+            }
+          }
+        }
+      });
+
+    vtkNew<vtkPoints> points;
+    points->SetData(positions);
+    output->SetPoints(points);
+    if (normals)
+    {
+      output->GetPointData()->SetNormals(normals);
+    }
+  }
+
+  vtkWeakPointer<vtkPolyData> Mesh;
+  vtkSmartPointer<vtkDataArray> MeshNormals;
+  vtkIdType NumberOfPoints = 0;
+  bool HasNormals = false;
+  int NumberOfKeyframes = 0;
+
+  // Four values per point per keyframe, and two tuples per keyframe for the bounding boxes
+  std::vector<unsigned short> Encoded;
+  std::vector<float> Bounds;
+};
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkF3DVertexAnimation);
+vtkInformationKeyMacro(vtkF3DVertexAnimation, VERTEX_ANIMATION, ObjectBase);
+
+//----------------------------------------------------------------------------
+vtkF3DVertexAnimation::vtkF3DVertexAnimation()
+  : Internals(new vtkF3DVertexAnimation::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkF3DVertexAnimation::~vtkF3DVertexAnimation() = default;
+
+//----------------------------------------------------------------------------
+vtkF3DVertexAnimation* vtkF3DVertexAnimation::GetVertexAnimation(vtkPolyData* mesh)
+{
+  return mesh ? vtkF3DVertexAnimation::SafeDownCast(
+                  mesh->GetInformation()->Get(vtkF3DVertexAnimation::VERTEX_ANIMATION()))
+              : nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DVertexAnimation::SetMesh(vtkPolyData* mesh)
+{
+  vtkInternals& internals = *this->Internals;
+  if (internals.Mesh && vtkF3DVertexAnimation::GetVertexAnimation(internals.Mesh) == this)
+  {
+    internals.Mesh->GetInformation()->Remove(vtkF3DVertexAnimation::VERTEX_ANIMATION());
+  }
+  internals.Mesh = mesh;
+  internals.MeshNormals = nullptr;
+  internals.NumberOfPoints = 0;
+  internals.HasNormals = false;
+  internals.NumberOfKeyframes = 0;
+  internals.Encoded.clear();
+  internals.Bounds.clear();
+
+  if (mesh && mesh->GetPoints())
+  {
+    internals.MeshNormals = mesh->GetPointData()->GetNormals();
+    internals.NumberOfPoints = mesh->GetNumberOfPoints();
+    internals.HasNormals = internals.MeshNormals != nullptr;
+    internals.Encode(mesh->GetPoints()->GetData(), internals.MeshNormals);
+    mesh->GetInformation()->Set(vtkF3DVertexAnimation::VERTEX_ANIMATION(), this);
+  }
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+vtkPolyData* vtkF3DVertexAnimation::GetMesh()
+{
+  return this->Internals->Mesh;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DVertexAnimation::AddKeyframe(vtkDataArray* positions, vtkDataArray* normals)
+{
+  vtkInternals& internals = *this->Internals;
+  if (internals.NumberOfKeyframes == 0)
+  {
+    vtkErrorMacro("A mesh with points must be set before adding keyframes");
+    return -1;
+  }
+
+  if (!positions || positions->GetNumberOfComponents() != 3 ||
+    positions->GetNumberOfTuples() != internals.NumberOfPoints)
+  {
+    vtkErrorMacro("Keyframe positions do not match the points of the mesh");
+    return -1;
+  }
+  if (normals &&
+    (!internals.HasNormals || normals->GetNumberOfComponents() != 3 ||
+      normals->GetNumberOfTuples() != internals.NumberOfPoints))
+  {
+    vtkErrorMacro("Keyframe normals do not match the normals of the mesh");
+    return -1;
+  }
+
+  internals.Encode(positions, normals ? normals : internals.MeshNormals.Get());
+  this->Modified();
+  return internals.NumberOfKeyframes - 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DVertexAnimation::GetNumberOfKeyframes()
+{
+  return this->Internals->NumberOfKeyframes;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkF3DVertexAnimation::GetNumberOfPoints()
+{
+  return this->Internals->NumberOfPoints;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DVertexAnimation::GetHasNormals()
+{
+  return this->Internals->HasNormals;
+}
+
+//----------------------------------------------------------------------------
+const std::vector<unsigned short>& vtkF3DVertexAnimation::GetEncodedKeyframes()
+{
+  return this->Internals->Encoded;
+}
+
+//----------------------------------------------------------------------------
+const std::vector<float>& vtkF3DVertexAnimation::GetKeyframeBounds()
+{
+  return this->Internals->Bounds;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DVertexAnimation::InterpolateKeyframes(
+  vtkActor* actor, int first, int second, double factor)
+{
+  const int nbKeyframes = this->GetNumberOfKeyframes();
+  if (!actor || nbKeyframes == 0)
+  {
+    return;
+  }
+
+  first = std::clamp(first, 0, nbKeyframes - 1);
+  second = std::clamp(second, 0, nbKeyframes - 1);
+  factor = std::clamp(factor, 0.0, 1.0);
+
+#ifdef F3D_USE_GLES
+  // Texture buffers are not supported with GLES, interpolate in the mesh instead
+  if (this->Internals->Mesh)
+  {
+    this->Internals->Interpolate(first, second, factor, this->Internals->Mesh);
+  }
+#else
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  uniforms->SetUniformi("keyframeFirst", first);
+  uniforms->SetUniformi("keyframeSecond", second);
+  uniforms->SetUniformf("keyframeFactor", static_cast<float>(factor));
+#endif
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPolyData> vtkF3DVertexAnimation::GetAnimatedMesh(
+  vtkActor* actor, vtkPolyData* input)
+{
+  vtkF3DVertexAnimation* animation = vtkF3DVertexAnimation::GetVertexAnimation(input);
+  if (!actor || !animation || animation->GetNumberOfPoints() != input->GetNumberOfPoints())
+  {
+    return input;
+  }
+
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  int first;
+  int second;
+  float factor;
+  if (!uniforms->GetUniformi("keyframeFirst", first) ||
+    !uniforms->GetUniformi("keyframeSecond", second) ||
+    !uniforms->GetUniformf("keyframeFactor", factor))
+  {
+    return input;
+  }
+
+  // The output is not animated by the shaders anymore
+  vtkNew<vtkPolyData> output;
+  output->ShallowCopy(input);
+  output->GetInformation()->Remove(vtkF3DVertexAnimation::VERTEX_ANIMATION());
+  animation->Internals->Interpolate(first, second, factor, output);
+  return output;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DVertexAnimation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfKeyframes: " << this->GetNumberOfKeyframes() << "\n";
+  os << indent << "NumberOfPoints: " << this->GetNumberOfPoints() << "\n";
+  os << indent << "HasNormals: " << this->GetHasNormals() << "\n";
+}
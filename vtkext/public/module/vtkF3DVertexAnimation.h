@@ -0,0 +1,131 @@
+/**
+ * @class   vtkF3DVertexAnimation
+ * @brief   Keyframed vertex animation interpolated on the GPU
+ *
+ * This helper is provided to importers of formats animated by storing the positions of all the
+ * vertices of a mesh for each keyframe, like Quake MDL models.
+ * Instead of displaying a mesh per keyframe, which uploads the whole geometry each time the
+ * keyframe changes, the keyframes are stored once in a compact form, like MDL frames: a position
+ * is quantized on 16 bits per coordinate in the bounding box of its keyframe and a normal is
+ * octahedral encoded on 16 bits, so a vertex takes 8 bytes per keyframe.
+ * The keyframes are not stored in the point data of the mesh but in this object, found from the
+ * information of the mesh. They are uploaded once to the GPU by vtkF3DPolyDataMapper and the
+ * vertex shader interpolates between the two keyframes selected on the actor, so only a few
+ * uniforms change when the time changes.
+ *
+ * With GLES, which does not support texture buffers, the keyframes are interpolated on the CPU
+ * into the points and normals of the mesh instead.
+ */
+
+#ifndef vtkF3DVertexAnimation_h
+#define vtkF3DVertexAnimation_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <vtkObject.h>
+#include <vtkSmartPointer.h>
+/// @endcond
+
+#include <memory>
+#include <vector>
+
+class vtkActor;
+class vtkDataArray;
+class vtkInformationObjectBaseKey;
+class vtkPolyData;
+
+class VTKEXT_EXPORT vtkF3DVertexAnimation : public vtkObject
+{
+public:
+  static vtkF3DVertexAnimation* New();
+  vtkTypeMacro(vtkF3DVertexAnimation, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Information key used to store the animation in the information of its mesh.
+   */
+  static vtkInformationObjectBaseKey* VERTEX_ANIMATION();
+
+  /**
+   * Get the animation of a mesh, nullptr if it is not animated.
+   */
+  static vtkF3DVertexAnimation* GetVertexAnimation(vtkPolyData* mesh);
+
+  /**
+   * Set the mesh to animate, which should be the input of the mapper of the animated actor.
+   * The points and normals of the mesh are the first keyframe.
+   * The mesh is not referenced by the animation, which is stored in the information of the mesh.
+   * Remove the keyframes previously added.
+   */
+  void SetMesh(vtkPolyData* mesh);
+
+  /**
+   * Get the animated mesh, nullptr if it was deleted.
+   */
+  vtkPolyData* GetMesh();
+
+  /**
+   * Add a keyframe from the positions and optional normals of all the points of the mesh.
+   * The normals of the mesh are used if the normals are not provided.
+   * Keyframes must be added before rendering.
+   * Return the index of the keyframe, or -1 if the arrays do not match the mesh.
+   */
+  int AddKeyframe(vtkDataArray* positions, vtkDataArray* normals = nullptr);
+
+  /**
+   * Get the number of keyframes, including the first one provided by the mesh.
+   */
+  int GetNumberOfKeyframes();
+
+  /**
+   * Get the number of points of a keyframe.
+   */
+  vtkIdType GetNumberOfPoints();
+
+  /**
+   * Check if the keyframes store normals, which is the case when the mesh has normals.
+   */
+  bool GetHasNormals();
+
+  /**
+   * Get the encoded keyframes, with four values per point: the position quantized in the
+   * bounding box of the keyframe and the two 8 bits coordinates of the octahedral encoded normal.
+   * The point p of the keyframe k starts at 4 * (k * GetNumberOfPoints() + p).
+   */
+  const std::vector<unsigned short>& GetEncodedKeyframes();
+
+  /**
+   * Get the bounding boxes of the keyframes, as two 4-components tuples per keyframe:
+   * the origin and the size of the box, a quantized coordinate q being decoded as
+   * origin + size * q / 65535.
+   */
+  const std::vector<float>& GetKeyframeBounds();
+
+  /**
+   * Display the interpolation between two keyframes on the actor, factor being in [0, 1].
+   * This sets the keyframeFirst, keyframeSecond and keyframeFactor uniforms of the actor, which
+   * are used by the shaders, or interpolates the mesh with GLES.
+   */
+  void InterpolateKeyframes(vtkActor* actor, int first, int second, double factor);
+
+  /**
+   * Return the input with the points and normals interpolated from the keyframes displayed by
+   * the actor, as displayed by the shaders.
+   * The input is returned as is if it is not animated by the shaders of the actor.
+   */
+  static vtkSmartPointer<vtkPolyData> GetAnimatedMesh(vtkActor* actor, vtkPolyData* input);
+
+protected:
+  vtkF3DVertexAnimation();
+  ~vtkF3DVertexAnimation() override;
+
+private:
+  vtkF3DVertexAnimation(const vtkF3DVertexAnimation&) = delete;
+  void operator=(const vtkF3DVertexAnimation&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -1,7 +1,9 @@
 #include <emscripten/bind.h>
 
 #include <array>
+#include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 #include "camera.h"
 #include "engine.h"
@@ -45,6 +47,64 @@ emscripten::val containerToJSArray(const T& container)
   return jsArray;
 }
 
+/**
+ * Copy a JS Array or TypedArray of bytes into a vector.
+ * TypedArrays are copied into the WASM heap with a single bulk `set` call
+ * instead of being read element by element across the JS/WASM boundary.
+ */
+std::vector<std::byte> bytesFromJS(const emscripten::val& jsbuf)
+{
+  const size_t length = jsbuf["length"].as<size_t>();
+  std::vector<std::byte> data(length);
+  emscripten::val view(
+    emscripten::typed_memory_view(length, reinterpret_cast<uint8_t*>(data.data())));
+  view.call<void>("set", jsbuf);
+  return data;
+}
+
+/**
+ * Copy a heap buffer into a new JS Uint8Array owned by the JS garbage collector.
+ * Must be used when the native buffer does not outlive the returned value.
+ */
+emscripten::val bytesToJS(const uint8_t* data, size_t size)
+{
+  emscripten::val view(emscripten::typed_memory_view(size, data));
+  return emscripten::val::global("Uint8Array").new_(view);
+}
+
+/**
+ * A byte buffer allocated in the WASM heap that JS can write into directly,
+ * through the Uint8Array returned by `view()`, before handing it to f3d without any copy.
+ */
+class heap_buffer
+{
+public:
+  explicit heap_buffer(size_t size)
+    : Data(size)
+  {
+  }
+
+  emscripten::val view()
+  {
+    // The view is invalidated if the WASM memory grows, it must be requested again in that case
+    return emscripten::val(
+      emscripten::typed_memory_view(this->Data.size(), reinterpret_cast<uint8_t*>(this->Data.data())));
+  }
+
+  size_t size() const
+  {
+    return this->Data.size();
+  }
+
+  std::byte* data()
+  {
+    return this->Data.data();
+  }
+
+private:
+  std::vector<std::byte> Data;
+};
+
 template<typename U, typename V>
 emscripten::val pairToJSArray(const std::pair<U, V>& p)
 {
@@ -199,6 +259,12 @@ EMSCRIPTEN_BINDINGS(f3d)
       "cycle", +[](f3d::options& o, const std::string& name) -> f3d::options&
       { return o.cycle(name); }, emscripten::return_value_policy::reference());
 
+  // heap_buffer
+  emscripten::class_<heap_buffer>("HeapBuffer")
+    .constructor<size_t>()
+    .property("size", &heap_buffer::size)
+    .function("view", &heap_buffer::view);
+
   // f3d::scene
   // TODO:
   // - add lights support
@@ -225,10 +291,14 @@ EMSCRIPTEN_BINDINGS(f3d)
       "addBuffer",
       +[](f3d::scene& scene, emscripten::val jsbuf) -> f3d::scene&
       {
-        std::vector<unsigned char> data = emscripten::vecFromJSArray<unsigned char>(jsbuf);
-        return scene.add(reinterpret_cast<std::byte*>(data.data()), data.size());
+        std::vector<std::byte> data = bytesFromJS(jsbuf);
+        return scene.add(data.data(), data.size());
       },
       emscripten::return_value_policy::reference())
+    .function(
+      "addHeapBuffer", +[](f3d::scene& scene, heap_buffer& buffer) -> f3d::scene&
+      { return scene.add(buffer.data(), buffer.size()); },
+      emscripten::return_value_policy::reference())
     .function("clear", &f3d::scene::clear, emscripten::return_value_policy::reference())
     .function(
       "getAddedFiles",
@@ -308,7 +378,7 @@ EMSCRIPTEN_BINDINGS(f3d)
       "setContent",
       +[](f3d::image& img, emscripten::val jsbuf) -> f3d::image&
       {
-        std::vector<uint8_t> data = emscripten::vecFromJSArray<uint8_t>(jsbuf);
+        std::vector<std::byte> data = bytesFromJS(jsbuf);
         size_t expected = static_cast<size_t>(img.getWidth()) * img.getHeight() *
           img.getChannelCount() * img.getChannelTypeSize();
         if (data.size() != expected)
@@ -323,8 +393,9 @@ EMSCRIPTEN_BINDINGS(f3d)
       "getContent",
       +[](const f3d::image& img) -> emscripten::val
       {
-        size_t totalSize =
-          img.getWidth() * img.getHeight() * img.getChannelCount() * img.getChannelTypeSize();
+        // zero-copy view on the image content, only valid while the image is alive
+        size_t totalSize = static_cast<size_t>(img.getWidth()) * img.getHeight() *
+          img.getChannelCount() * img.getChannelTypeSize();
         return emscripten::val(
           emscripten::typed_memory_view(totalSize, static_cast<const uint8_t*>(img.getContent())));
       },
@@ -339,8 +410,9 @@ EMSCRIPTEN_BINDINGS(f3d)
       "saveBuffer",
       +[](const f3d::image& img, f3d::image::SaveFormat format) -> emscripten::val
       {
+        // the buffer is local, copy it into a JS owned array before it is released
         std::vector<uint8_t> buffer = img.saveBuffer(format);
-        return emscripten::val(emscripten::typed_memory_view(buffer.size(), buffer.data()));
+        return bytesToJS(buffer.data(), buffer.size());
       })
     .function("toTerminalText",
       static_cast<std::string (f3d::image::*)() const>(&f3d::image::toTerminalText))
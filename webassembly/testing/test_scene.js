@@ -4,6 +4,13 @@ const settings = {
   runBefore: (Module) => {
     // does nothing but called for coverage
     Module.engineInstance.getScene().addBuffer(new Array());
+    Module.engineInstance.getScene().addBuffer(new Uint8Array());
+
+    const heapBuffer = new Module.HeapBuffer(0);
+    utils.assert(heapBuffer.size === 0, "heap buffer size");
+    utils.assert(heapBuffer.view().length === 0, "heap buffer view length");
+    Module.engineInstance.getScene().addHeapBuffer(heapBuffer);
+    heapBuffer.delete();
     Module.engineInstance.getScene().clear();
 
     utils.assert(